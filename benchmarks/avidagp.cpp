@@ -0,0 +1,70 @@
+// Microbenchmarks for AvidaGP components: AvidaGPReplicator::SingleProcess (on the ancestor genome),
+// AvidaGPMultiPathwayTask::AfterOrgProcessStep, and AvidaGPEnvironmentBank::GenerateBank.
+// Usage: ./bench-avidagp.out [environment file] [ancestor file]
+
+#include <string>
+
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPOrganism.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMultiPathwayTask.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPEnvironmentBank.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPTaskSet.hpp"
+
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/DirectedDevoConfig.hpp"
+
+#include "bench_utils.hpp"
+
+int main(int argc, char* argv[]) {
+  using org_t = dirdevo::AvidaGPOrganism;
+  using task_t = dirdevo::AvidaGPMultiPathwayTask;
+  using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
+
+  const std::string env_file = (argc > 1) ? argv[1] : "environment-big.json";
+  const std::string ancestor_file = (argc > 2) ? argv[2] : "ancestor-100.gen";
+
+  dirdevo::bench::BenchRunner runner("avidagp");
+
+  // Need a world with an AvidaGP task for the instruction set and environment.
+  dirdevo::DirectedDevoConfig config;
+  config.SEED(runner.GetSeed());
+  config.AVIDAGP_ENV_FILE(env_file);
+  config.ANCESTOR_FILE(ancestor_file);
+  emp::Random random(config.SEED());
+  world_t world(config, random);
+
+  // --- AvidaGPReplicator::SingleProcess ---
+  dirdevo::AvidaGPReplicator hw(world.GetTask().GetInstLib());
+  hw.Load(ancestor_file);
+  const auto ancestor_genome = hw.GetGenome();
+  runner.Run("SingleProcess/ancestor", [&hw]() {
+    hw.SingleProcess();
+    // The ancestor self-replicates; start over each time it divides (as the organism does on reproduction).
+    if (hw.IsDividing()) hw.ResetReplicatorHardware();
+  });
+
+  // --- AvidaGPMultiPathwayTask::AfterOrgProcessStep ---
+  // Each step, the organism outputs one correct value (ECHO) and one incorrect value.
+  world.InjectAt(ancestor_genome, 0);
+  auto& org = world.GetOrg(0);
+  auto& task = world.GetTask();
+  const double echo_output = org.GetHardware().GetInputBuffer(0)[0];
+  runner.Run("AfterOrgProcessStep", [&org, &task, echo_output]() {
+    auto& output_buffer = org.GetHardware().GetOutputBuffer(0);
+    output_buffer.emplace_back(echo_output);
+    output_buffer.emplace_back(echo_output + 1);
+    task.AfterOrgProcessStep(org);
+  });
+
+  // --- AvidaGPEnvironmentBank::GenerateBank ---
+  // Items are environments generated.
+  const size_t bank_size = config.AVIDAGP_ENV_BANK_SIZE();
+  dirdevo::AvidaGPTaskSet task_set;
+  dirdevo::AvidaGPEnvironmentBank env_bank(random, task_set);
+  runner.Run("GenerateBank/count=" + std::to_string(bank_size), [&env_bank, bank_size]() {
+    env_bank.GenerateBank(bank_size);
+  }, bank_size);
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#ifndef DIRECTED_DEVO_BENCHMARKS_BENCH_UTILS_HPP_INCLUDE
+#define DIRECTED_DEVO_BENCHMARKS_BENCH_UTILS_HPP_INCLUDE
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+namespace dirdevo {
+namespace bench {
+
+/// Prevent the compiler from optimizing away a value we computed only for benchmarking purposes.
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Minimal benchmark harness.
+/// Each benchmark is run with a doubling number of iterations until a single timed run takes at least
+/// min_time seconds. Results are written to an output stream as CSV rows (no header; `make bench` writes it) with
+/// the columns:
+///   suite,benchmark,iterations,seconds,ns_per_iteration,items_per_second
+/// The minimum run time can be set with the DIRDEVO_BENCH_MIN_TIME environment variable (in seconds), and the
+/// random number seed that benchmarks should use with DIRDEVO_BENCH_SEED (e.g., to train PGO on other inputs).
+class BenchRunner {
+protected:
+  std::string suite;
+  std::ostream& out;
+  double min_time=0.5;
+  int seed=1;
+
+public:
+  BenchRunner(const std::string& a_suite, std::ostream& a_out=std::cout) :
+    suite(a_suite),
+    out(a_out)
+  {
+    if (const char* env_min_time = std::getenv("DIRDEVO_BENCH_MIN_TIME")) {
+      min_time = std::atof(env_min_time);
+    }
+    if (const char* env_seed = std::getenv("DIRDEVO_BENCH_SEED")) {
+      seed = std::atoi(env_seed);
+    }
+  }
+
+  /// Random number seed for benchmark inputs.
+  int GetSeed() const { return seed; }
+
+  /// Benchmark fun (one call = one iteration).
+  /// If fun returns a count, it is treated as the number of items processed by that iteration (used to
+  /// compute items_per_second); otherwise, each iteration processes items_per_iteration items.
+  template<typename FUN>
+  void Run(const std::string& name, FUN&& fun, size_t items_per_iteration=1) {
+    using clock_t = std::chrono::steady_clock;
+    size_t iterations = 1;
+    while (true) {
+      size_t items = 0;
+      const auto start = clock_t::now();
+      for (size_t i = 0; i < iterations; ++i) {
+        if constexpr (std::is_void_v<std::invoke_result_t<FUN&>>) {
+          fun();
+          items += items_per_iteration;
+        } else {
+          items += (size_t)fun();
+        }
+      }
+      const double seconds = std::chrono::duration<double>(clock_t::now() - start).count();
+      if (seconds >= min_time || iterations >= ((size_t)1 << 40)) {
+        Report(name, iterations, seconds, items);
+        return;
+      }
+      iterations *= 2;
+    }
+  }
+
+  void Report(const std::string& name, size_t iterations, double seconds, size_t items) {
+    out << suite << ","
+        << name << ","
+        << iterations << ","
+        << std::setprecision(9) << seconds << ","
+        << (seconds * 1e9 / (double)iterations) << ","
+        << ((seconds > 0) ? (double)items / seconds : 0.0)
+        << std::endl;
+  }
+};
+
+} // namespace bench
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_BENCHMARKS_BENCH_UTILS_HPP_INCLUDE
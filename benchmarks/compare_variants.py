@@ -0,0 +1,41 @@
+"""
+Compare benchmark results across optimization variants (see `make bench-variants`).
+
+Usage: python compare_variants.py variants/baseline/bench_results.csv variants/lto/bench_results.csv ...
+- The first results file is the baseline; each file's variant name is its parent directory.
+- Writes CSV (to stdout) with one row per benchmark per variant:
+  suite,benchmark,variant,ns_per_iteration,speedup
+  where speedup = baseline ns_per_iteration / variant ns_per_iteration (> 1 is faster than baseline).
+- The last rows (benchmark=geomean) give each variant's geometric mean speedup over all benchmarks.
+"""
+
+import csv, math, os, sys
+
+def read_results(path):
+    """Read a bench_results.csv into a map from (suite, benchmark) to ns_per_iteration."""
+    with open(path, "r") as fp:
+        return {(row["suite"], row["benchmark"]): float(row["ns_per_iteration"]) for row in csv.DictReader(fp)}
+
+def main():
+    paths = sys.argv[1:]
+    if len(paths) < 2:
+        print("Usage: python compare_variants.py baseline_results.csv variant_results.csv ...", file=sys.stderr)
+        sys.exit(1)
+    variants = [(os.path.basename(os.path.dirname(os.path.abspath(path))), read_results(path)) for path in paths]
+    baseline = variants[0][1]
+
+    writer = csv.writer(sys.stdout, lineterminator="\n")
+    writer.writerow(["suite", "benchmark", "variant", "ns_per_iteration", "speedup"])
+    log_speedups = {name:[] for name, _ in variants}
+    for key, base_ns in baseline.items():
+        for name, results in variants:
+            if key not in results: continue
+            speedup = base_ns / results[key]
+            log_speedups[name].append(math.log(speedup))
+            writer.writerow([key[0], key[1], name, results[key], f"{speedup:.3f}"])
+    for name, logs in log_speedups.items():
+        if len(logs) == 0: continue
+        writer.writerow(["all", "geomean", name, "", f"{math.exp(sum(logs) / len(logs)):.3f}"])
+
+if __name__ == "__main__":
+    main()
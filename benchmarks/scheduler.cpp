@@ -0,0 +1,60 @@
+// Microbenchmarks for ProbabilisticScheduler (GetRandom, AdjustWeight, bulk weight loading, and reseeding).
+
+#include <string>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/ProbabilisticScheduler.hpp"
+
+#include "bench_utils.hpp"
+
+int main() {
+  dirdevo::bench::BenchRunner runner("scheduler");
+  emp::Random random(runner.GetSeed());
+
+  // 100 = default world size (10x10 grid); 1024 = a large world.
+  for (size_t num_items : emp::vector<size_t>({100, 1024})) {
+    const std::string size_str = "/items=" + std::to_string(num_items);
+    dirdevo::ProbabilisticScheduler scheduler(random, num_items);
+    for (size_t i = 0; i < num_items; ++i) {
+      scheduler.AdjustWeight(i, random.GetDouble(1, 100));
+    }
+
+    // Draw with unchanging weights.
+    runner.Run("GetRandom" + size_str, [&scheduler]() {
+      dirdevo::bench::DoNotOptimize(scheduler.GetRandom());
+    });
+
+    // Adjust weights without drawing (refresh is deferred until the next draw).
+    runner.Run("AdjustWeight" + size_str, [&scheduler, &random, num_items]() {
+      scheduler.AdjustWeight(random.GetUInt(num_items), random.GetDouble(1, 100));
+    });
+
+    // Adjust one weight, then draw (the access pattern of DirectedDevoWorld::RunStep, where births/deaths
+    // change weights between draws).
+    runner.Run("AdjustWeight+GetRandom" + size_str, [&scheduler, &random, num_items]() {
+      scheduler.AdjustWeight(random.GetUInt(num_items), random.GetDouble(1, 100));
+      dirdevo::bench::DoNotOptimize(scheduler.GetRandom());
+    });
+
+    // Replace every weight from a contiguous buffer, then draw (a full DirectedDevoWorld::SyncSchedulerWeights).
+    emp::vector<double> merits(num_items);
+    for (double& merit : merits) merit = random.GetDouble(1, 100);
+    runner.Run("LoadWeights+GetRandom" + size_str, [&scheduler, &merits]() {
+      scheduler.LoadWeights(merits);
+      dirdevo::bench::DoNotOptimize(scheduler.GetRandom());
+    }, num_items);
+
+    // Empty the scheduler, give one item weight, then draw (seeding a world with a single-organism propagule).
+    runner.Run("Reseed+GetRandom" + size_str, [&scheduler, &random]() {
+      scheduler.ClearWeights();
+      scheduler.DeferWeightRefresh();
+      scheduler.AdjustWeight(0, random.GetDouble(1, 100));
+      dirdevo::bench::DoNotOptimize(scheduler.GetRandom());
+      scheduler.AdjustWeight(0, 0);
+    });
+  }
+
+  return 0;
+}
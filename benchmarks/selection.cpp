@@ -0,0 +1,87 @@
+// Microbenchmarks for each selection scheme (on 1000-world score tables) and find_pareto_front.
+
+#include <algorithm>
+#include <string>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/selection/SelectionSchemes.hpp"
+#include "dirdevo/utility/pareto.hpp"
+#include "dirdevo/utility/ScoreMatrix.hpp"
+
+#include "bench_utils.hpp"
+
+int main() {
+  dirdevo::bench::BenchRunner runner("selection");
+  emp::Random random(runner.GetSeed());
+
+  constexpr size_t num_worlds = 1000;
+  constexpr size_t num_objectives = 10;  // E.g., one objective per world-level task
+  constexpr size_t max_score = 20;       // Small integer scores so that ties are common (as with task counts)
+  constexpr size_t tournament_size = 4;
+
+  // Score buffers (one row per world), laid out the same way the experiment's are.
+  dirdevo::ScoreMatrix score_matrix(num_worlds, num_objectives);
+  emp::vector<double> aggregate_scores(num_worlds, 0);
+  for (size_t world_id = 0; world_id < num_worlds; ++world_id) {
+    for (size_t obj_id = 0; obj_id < num_objectives; ++obj_id) {
+      score_matrix(world_id, obj_id) = random.GetUInt(max_score + 1);
+      aggregate_scores[world_id] += score_matrix(world_id, obj_id);
+    }
+  }
+  // find_pareto_front (the reference implementation) takes a table of score vectors.
+  emp::vector< emp::vector<double> > score_table(num_worlds, emp::vector<double>(num_objectives, 0));
+  for (size_t world_id = 0; world_id < num_worlds; ++world_id) {
+    std::copy(score_matrix.GetRow(world_id), score_matrix.GetRow(world_id) + num_objectives, score_table[world_id].begin());
+  }
+
+  // Each selection benchmark selects num_worlds worlds (i.e., one epoch of selection); items are selected worlds.
+  dirdevo::EliteSelect elite(aggregate_scores, 1);
+  runner.Run("elite", [&elite]() { elite(num_worlds); }, num_worlds);
+
+  dirdevo::TournamentSelect tournament(aggregate_scores, random, tournament_size);
+  runner.Run("tournament", [&tournament]() { tournament(num_worlds); }, num_worlds);
+
+  dirdevo::LexicaseSelect lexicase(score_matrix, random);
+  runner.Run("lexicase", [&lexicase]() { lexicase(num_worlds); }, num_worlds);
+
+  dirdevo::LexicaseSelect epsilon_lexicase(score_matrix, random, -1.0);
+  runner.Run("epsilon-lexicase", [&epsilon_lexicase]() { epsilon_lexicase(num_worlds); }, num_worlds);
+
+  dirdevo::NonDominatedEliteSelect nd_elite(score_matrix, random);
+  runner.Run("non-dominated-elite", [&nd_elite]() { nd_elite(num_worlds); }, num_worlds);
+
+  dirdevo::NonDominatedTournamentSelect nd_tournament(score_matrix, random, tournament_size);
+  runner.Run("non-dominated-tournament", [&nd_tournament]() { nd_tournament(num_worlds); }, num_worlds);
+
+  dirdevo::NonDominatedSortingSelect nd_sorting(score_matrix, random, tournament_size);
+  runner.Run("non-dominated-sorting", [&nd_sorting]() { nd_sorting(num_worlds); }, num_worlds);
+
+  dirdevo::RandomSelect random_select(random, num_worlds);
+  runner.Run("random", [&random_select]() { random_select(num_worlds); }, num_worlds);
+
+  // Pareto front on the full table (items are candidates considered).
+  runner.Run("find_pareto_front", [&score_table]() {
+    dirdevo::bench::DoNotOptimize(dirdevo::find_pareto_front(score_table).size());
+  }, num_worlds);
+
+  emp::vector<size_t> front;
+  runner.Run("find_pareto_front_fast", [&score_matrix, &front]() {
+    dirdevo::find_pareto_front_fast(score_matrix, front);
+    dirdevo::bench::DoNotOptimize(front.size());
+  }, num_worlds);
+
+  // Non-dominated sorting on a large (EC-sized) table of organism task counts (mostly 0s and small counts).
+  constexpr size_t num_large = 10000;
+  dirdevo::ScoreMatrix large_matrix(num_large, num_objectives);
+  for (double& score : large_matrix.GetData()) score = (random.P(0.5)) ? 0 : random.GetUInt(4);
+  emp::vector< emp::vector<size_t> > fronts;
+  emp::vector<size_t> ranks;
+  runner.Run("non_dominated_sort/candidates=" + std::to_string(num_large), [&large_matrix, &fronts, &ranks]() {
+    dirdevo::non_dominated_sort(large_matrix, fronts, ranks);
+    dirdevo::bench::DoNotOptimize(fronts.size());
+  }, num_large);
+
+  return 0;
+}
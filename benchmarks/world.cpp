@@ -0,0 +1,150 @@
+// End-to-end benchmark: organism steps per second for DirectedDevoWorld::RunStep (OneMax and AvidaGP).
+// OneMax worlds are also run under each population structure (mixed, grid, grid3d) at a couple of world sizes, along
+// with a birth placement microbenchmark, to show the cost of spatial structure.
+// Usage: ./bench-world.out [environment file] [ancestor file]
+
+#include <string>
+
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/DirectedDevoConfig.hpp"
+#include "dirdevo/utility/PopulationStore.hpp"
+
+#include "dirdevo/mutator/BitSetMutator.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxTask.hpp"
+
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPOrganism.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMutator.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMultiPathwayTask.hpp"
+
+#include "bench_utils.hpp"
+
+/// Number of updates to run before timing (so that the world is at its steady-state population size).
+constexpr size_t WARMUP_UPDATES = 200;
+
+/// Build a world seeded with a single ancestor (as the experiment does), warm it up, then time world updates.
+/// Items are organism steps (i.e., the organism step budget of each update).
+template<typename WORLD_T, typename MUTATOR_T, typename GENOME_FUN>
+void BenchWorld(
+  dirdevo::bench::BenchRunner& runner,
+  const std::string& name,
+  const dirdevo::DirectedDevoConfig& config,
+  GENOME_FUN get_ancestor
+) {
+  emp::Random random(config.SEED());
+  WORLD_T world(config, random, name);
+  world.SetAvgOrgStepsPerUpdate(config.AVG_STEPS_PER_ORG());
+  MUTATOR_T mutator;
+  MUTATOR_T::Configure(mutator, config);
+  world.SetMutator(mutator);
+  world.InjectAt(get_ancestor(world), 0);
+  world.SyncSchedulerWeights();
+
+  auto run_update = [&world, &config]() {
+    const size_t org_steps = world.GetNumOrgs() * config.AVG_STEPS_PER_ORG();
+    world.RunStep();
+    world.Update();
+    return org_steps;
+  };
+  for (size_t u = 0; u < WARMUP_UPDATES; ++u) run_update();
+
+  runner.Run(name + "/" + config.LOCAL_POP_STRUCTURE() + "/orgs=" + std::to_string(world.GetNumOrgs()), run_update);
+}
+
+/// A population structure to benchmark (width * height * depth cells).
+struct PopStructure {
+  std::string mode;
+  size_t width;
+  size_t height;
+  size_t depth;
+};
+
+/// Time picking offspring positions (random neighbors of random parents), i.e., the per-birth placement cost.
+void BenchPlacement(dirdevo::bench::BenchRunner& runner, const PopStructure& structure) {
+  struct Empty { };
+  dirdevo::PopulationStore<Empty> store;
+  if (structure.mode == "grid") {
+    store.SetGrid(structure.width, structure.height);
+  } else if (structure.mode == "grid3d") {
+    store.SetGrid3D(structure.width, structure.height, structure.depth);
+  } else {
+    store.SetMixed(structure.width * structure.height * structure.depth);
+  }
+  emp::Random random(runner.GetSeed());
+  const size_t births = 4096;
+  emp::vector<size_t> parents(births);
+  for (size_t& parent : parents) parent = random.GetUInt(store.GetSize());
+  runner.Run(
+    "placement/" + structure.mode + "/cells=" + std::to_string(store.GetSize()),
+    [&]() {
+      size_t sum = 0;
+      for (size_t parent : parents) sum += store.GetRandomNeighbor(parent, random);
+      dirdevo::bench::DoNotOptimize(sum);
+    },
+    births
+  );
+}
+
+int main(int argc, char* argv[]) {
+  const std::string env_file = (argc > 1) ? argv[1] : "environment-big.json";
+  const std::string ancestor_file = (argc > 2) ? argv[2] : "ancestor-100.gen";
+
+  dirdevo::bench::BenchRunner runner("world");
+
+  dirdevo::DirectedDevoConfig config;
+  config.SEED(runner.GetSeed());
+  config.AVIDAGP_ENV_FILE(env_file);
+  config.ANCESTOR_FILE(ancestor_file);
+
+  // OneMax
+  {
+    using org_t = dirdevo::OneMaxOrganism<256>;
+    using task_t = dirdevo::OneMaxTask<org_t>;
+    using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
+    BenchWorld<world_t, dirdevo::BitSetMutator>(runner, "RunStep/onemax", config,
+      [](world_t& world) { return org_t::GenerateAncestralGenome(world); }
+    );
+  }
+
+  // OneMax under each population structure (similar cell counts, so per-step costs are comparable)
+  {
+    using org_t = dirdevo::OneMaxOrganism<256>;
+    using task_t = dirdevo::OneMaxTask<org_t>;
+    using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
+    const emp::vector<PopStructure> structures = {
+      {"mixed", 32, 32, 1}, {"grid", 32, 32, 1}, {"grid3d", 16, 16, 4},
+      {"mixed", 100, 100, 1}, {"grid", 100, 100, 1}, {"grid3d", 22, 22, 20}
+    };
+    const PopStructure default_structure{
+      config.LOCAL_POP_STRUCTURE(), config.LOCAL_GRID_WIDTH(), config.LOCAL_GRID_HEIGHT(), config.LOCAL_GRID_DEPTH()
+    };
+    auto set_structure = [&config](const PopStructure& structure) {
+      config.LOCAL_POP_STRUCTURE(structure.mode);
+      config.LOCAL_GRID_WIDTH(structure.width);
+      config.LOCAL_GRID_HEIGHT(structure.height);
+      config.LOCAL_GRID_DEPTH(structure.depth);
+    };
+    for (const auto& structure : structures) {
+      BenchPlacement(runner, structure);
+      set_structure(structure);
+      BenchWorld<world_t, dirdevo::BitSetMutator>(runner, "RunStep/onemax", config,
+        [](world_t& world) { return org_t::GenerateAncestralGenome(world); }
+      );
+    }
+    set_structure(default_structure);
+  }
+
+  // AvidaGP (multi-pathway task)
+  {
+    using org_t = dirdevo::AvidaGPOrganism;
+    using task_t = dirdevo::AvidaGPMultiPathwayTask;
+    using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
+    BenchWorld<world_t, dirdevo::AvidaGPMutator>(runner, "RunStep/avidagp", config,
+      [](world_t& world) { return org_t::LoadAncestralGenome(world); }
+    );
+  }
+
+  return 0;
+}
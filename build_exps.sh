@@ -3,18 +3,7 @@
 
 make clean
 
-# Build single-threaded directed evolution model
-echo "Compiling single-threaded directed digital evolution..."
-export PROJECT=directed-digital-evolution
-export MAIN_CPP=source/native.cpp
-export THREADING=-DDIRDEVO_SINGLE_THREAD
-make native
+# Build the experiment executable (every experiment setup is compiled in; pick one with -EXPERIMENT_SETUP)
+echo "Compiling directed digital evolution..."
+make -j"$(nproc)" native
 echo "...Done."
-
-# Build single-threaded gp
-echo "Compiling single-threaded genetic programming experiment..."
-export PROJECT=avidagp-ec
-export MAIN_CPP=source/native-ec.cpp
-export THREADING=-DDIRDEVO_SINGLE_THREAD
-make native
-echo "...Done."
\ No newline at end of file
@@ -12,7 +12,8 @@ job_memory_request = "4G"
 job_account = "devolab"
 job_name = "11-15"
 cpus_per_node="1"
-executable = "avidagp-ec"
+executable = "directed-digital-evolution"
+experiment_setup = "avidagp-ec"
 base_script_filename = './base_script.txt'
 
 # Create combo object to collect all conditions we'll run
@@ -141,6 +142,9 @@ def main():
         # first, just copy over condition dictionary values
         run_param_info = {key:condition_dict[key] for key in condition_dict if not "_MULTI_PARAM_" in key}
         run_param_info["SEED"] = "${SEED}"
+        run_param_info["EXPERIMENT_SETUP"] = experiment_setup
+        # One thread per requested CPU (the config file asks for more threads than these jobs get)
+        run_param_info["NUM_THREADS"] = cpus_per_node
 
         if run_param_info["SELECTION_METHOD"] == "top-10":
             run_param_info["SELECTION_METHOD"] = "elite"
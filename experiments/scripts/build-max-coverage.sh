@@ -1,4 +1,4 @@
 #!/usr/bin/env bash
 
-g++ -O3 -DNDEBUG -msse4.2 -Wall -Wno-unused-function -std=c++17 -I../../third-party/Empirical/include/ -I../../include/ -I../../third-party/ max_coverage.cc -o max-coverage -lstdc++fs
-# g++ -g -Wall -Wno-unused-function -std=c++17 -I../../third-party/Empirical/include/ -I../../include/ -I../../third-party/ max_coverage.cc -o max-coverage -lstdc++fs
\ No newline at end of file
+g++ -O3 -DNDEBUG -msse4.2 -pthread -Wall -Wno-unused-function -std=c++17 -I../../third-party/Empirical/include/ -I../../include/ -I../../third-party/ max_coverage.cc -o max-coverage -lstdc++fs
+# g++ -g -pthread -Wall -Wno-unused-function -std=c++17 -I../../third-party/Empirical/include/ -I../../include/ -I../../third-party/ max_coverage.cc -o max-coverage -lstdc++fs
\ No newline at end of file
@@ -3,50 +3,100 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <functional>
 #include <filesystem>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <unordered_set>
 #include <sys/stat.h>
 
 #include "emp/config/config.hpp"
 #include "emp/config/ArgManager.hpp"
 #include "emp/config/command_line.hpp"
-#include "emp/io/File.hpp"
 #include "emp/bits/BitSet.hpp"
 #include "emp/bits/BitArray.hpp"
 #include "emp/tools/string_utils.hpp"
 #include "emp/datastructs/map_utils.hpp"
 #include "emp/data/DataFile.hpp"
 
+#include "dirdevo/utility/CsvReader.hpp"
+#include "dirdevo/utility/max_coverage.hpp"
+
 EMP_BUILD_CONFIG(MaxCovConfig,
   VALUE(SEED, int, -1, "Random number generator seed."),
   VALUE(POP_PROFILE_FILE, std::string, "population_profiles.csv", "Path to the environment file that specifies which tasks are rewarded at organism and world level"),
-  VALUE(OUTPUT_DIR, std::string, "output", "Where should the experiment dump output?")
+  VALUE(OUTPUT_DIR, std::string, "output", "Where should the experiment dump output?"),
+  VALUE(NUM_THREADS, size_t, 0, "Number of threads used to solve metapopulations concurrently. 0 = one per hardware thread"),
+  VALUE(CHECK_SOLUTIONS, bool, false, "Also solve each metapopulation with the (slow) reference solver and exit with an error if any coverage differs")
 )
 
-using csv_line_t = std::unordered_map<std::string, std::string>;
-using csv_data_t = emp::vector< csv_line_t >;
-
 constexpr size_t NUM_POP_TASKS=18;
 
-csv_data_t read_csv(std::ifstream& pop_profiles_fstream) {
-  emp_assert(pop_profiles_fstream.is_open());
-  // Load as empirical File
-  emp::File pop_profiles_file(pop_profiles_fstream);
-  // Process lines
-  // (1) Extract header
-  emp::vector<std::string> header = pop_profiles_file.ExtractRowAs<std::string>(',');
-  // (2) Extract lines as maps
-  auto data = pop_profiles_file.ToData<std::string>(',');
-  csv_data_t lines;
-  for (size_t data_i = 0; data_i < data.size(); ++data_i) {
-    lines.emplace_back();
-    for (size_t c = 0; c < data[data_i].size(); ++c) {
-      lines.back()[header[c]] = data[data_i][c];
-    }
+/// Population profile columns used to build metapopulations (in the order they're requested from the reader).
+const emp::vector<std::string> POP_PROFILE_COLUMNS={
+  "SEED", "epoch", "SELECTION_METHOD", "pop_level", "pop_id", "task_name", "task_coverage"
+};
+
+/// One (population-level) line of the population profiles file. Strings are views into the (mapped) file.
+struct PopProfileLine {
+  size_t seed=0;
+  int epoch=0;
+  std::string_view selection_method;
+  size_t pop_id=0;
+  std::string_view task_name;
+  bool task_covered=false;
+};
+
+/// Read the population-level lines of the population profiles file, parsing chunks of the file on num_threads threads.
+/// Lines are returned in file order. Returns the total number of lines read (including lines that were skipped).
+size_t read_pop_profiles(
+  const dirdevo::CsvReader& reader,
+  const emp::vector<size_t>& columns,
+  size_t num_threads,
+  emp::vector<PopProfileLine>& lines
+) {
+  const auto chunks = reader.Split(num_threads);
+  emp::vector< emp::vector<PopProfileLine> > chunk_lines(chunks.size());
+  emp::vector<size_t> chunk_num_lines(chunks.size(), 0);
+  auto read_chunk = [&](size_t chunk_i) {
+    chunk_num_lines[chunk_i] = reader.ForEachRow(chunks[chunk_i], columns,
+      [&chunk_lines, chunk_i](const dirdevo::CsvReader::Row& row) {
+        if (row[3] == "0") return; // Skip non-population-level tasks.
+        PopProfileLine& line = chunk_lines[chunk_i].emplace_back();
+        line.seed = row.GetAs<size_t>(0);
+        line.epoch = row.GetAs<int>(1);
+        line.selection_method = row[2];
+        line.pop_id = row.GetAs<size_t>(4);
+        line.task_name = row[5];
+        line.task_covered = row[6] == "1";
+      }
+    );
+  };
+  emp::vector<std::thread> threads;
+  for (size_t chunk_i = 1; chunk_i < chunks.size(); ++chunk_i) {
+    threads.emplace_back(read_chunk, chunk_i);
+  }
+  if (chunks.size()) read_chunk(0);
+  for (auto& thread : threads) {
+    thread.join();
   }
-  pop_profiles_fstream.close();
-  return lines;
+  // Stitch chunks back together in file order.
+  size_t total_lines = 0;
+  size_t total_pop_lines = 0;
+  for (size_t chunk_i = 0; chunk_i < chunks.size(); ++chunk_i) {
+    total_lines += chunk_num_lines[chunk_i];
+    total_pop_lines += chunk_lines[chunk_i].size();
+  }
+  lines.clear();
+  lines.reserve(total_pop_lines);
+  for (auto& chunk : chunk_lines) {
+    lines.insert(lines.end(), chunk.begin(), chunk.end());
+  }
+  return total_lines;
 }
 
 struct PopulationInfo {
@@ -103,8 +153,6 @@ struct MetapopulationInfo {
   emp::vector<TaskInfo> tasks;
   // emp::vector< std::unordered_set<size_t> >
 
-  std::unordered_map<std::string, size_t> task_name_to_id;
-
   size_t num_tasks_covered=0;
   emp::BitArray<NUM_POP_TASKS> covered_tasks; // TODO - try left/right orientation
 
@@ -124,26 +172,24 @@ struct MetapopulationInfo {
     // tasks.resize(NUM_POP_TASKS);
   }
 
-  void AddLine(csv_line_t& line) {
-    const size_t exp_pop_uid = emp::from_string<size_t>(line["pop_id"]);
+  void AddLine(size_t exp_pop_uid, std::string_view task_name, bool task_covered) {
     size_t pop_idx = 0;
 
     // Add (genera) task information
-    bool task_covered = line["task_coverage"] == "1";
-    const std::string& task_name = line["task_name"];
-    size_t task_idx = 0;
+    // (there are only a handful of tasks, so a linear search beats hashing the name)
+    auto task_it = std::find_if(
+      tasks.begin(),
+      tasks.end(),
+      [task_name](const TaskInfo& task) { return task.task_name == task_name; }
+    );
+    size_t task_idx = (size_t)(task_it - tasks.begin());
     // If first time seeing this task for metapopulation, track it.
-    if (!emp::Has(task_name_to_id, task_name)) {
-      // task_idx = emp::from_string<size_t>(line["task_id"]);
-      task_idx = tasks.size();
+    if (task_it == tasks.end()) {
       tasks.emplace_back(
         task_idx,
-        task_name
+        std::string(task_name)
       );
-      task_name_to_id[task_name] = task_idx;
       emp_assert(task_idx < NUM_POP_TASKS);
-    } else {
-      task_idx = task_name_to_id[task_name];
     }
     num_tasks_covered += (size_t)(task_covered & !covered_tasks[task_idx]);
 
@@ -192,8 +238,9 @@ struct SolveState {
 
 };
 
-// todo - add return type
-emp::vector<SolutionInfo> solver(MetapopulationInfo& metapop) {
+// Reference (original) solver: copies its search state at every branch, so it's slow on large metapopulations.
+// Kept to check the branch-and-bound solver (see CHECK_SOLUTIONS).
+emp::vector<SolutionInfo> reference_solver(MetapopulationInfo& metapop) {
   emp::vector<SolutionInfo> solutions(metapop.pops.size());
   const size_t max_possible_coverage = metapop.num_tasks_covered;
   auto& tasks = metapop.tasks;
@@ -472,6 +519,50 @@ emp::vector<SolutionInfo> solver(MetapopulationInfo& metapop) {
   return solutions;
 }
 
+// ---- Branch-and-bound solver (see dirdevo/utility/max_coverage.hpp) ----
+
+using dirdevo::task_mask_t;
+static_assert(NUM_POP_TASKS <= dirdevo::MAX_COVERAGE_TASKS, "Task coverage masks must fit in a 64-bit word.");
+
+task_mask_t to_mask(const emp::BitArray<NUM_POP_TASKS>& tasks) {
+  task_mask_t mask = 0;
+  for (size_t task_i = 0; task_i < NUM_POP_TASKS; ++task_i) {
+    if (tasks[task_i]) mask |= ((task_mask_t)1 << task_i);
+  }
+  return mask;
+}
+
+emp::BitArray<NUM_POP_TASKS> to_bits(task_mask_t mask) {
+  emp::BitArray<NUM_POP_TASKS> tasks;
+  tasks.Clear();
+  for (size_t task_i = 0; task_i < NUM_POP_TASKS; ++task_i) {
+    if (mask & ((task_mask_t)1 << task_i)) tasks.Set(task_i);
+  }
+  return tasks;
+}
+
+emp::vector<SolutionInfo> solver(MetapopulationInfo& metapop) {
+  auto& pops = metapop.pops;
+  emp_assert(pops.size());
+  emp::vector<task_mask_t> masks(pops.size());
+  for (size_t pop_i = 0; pop_i < pops.size(); ++pop_i) {
+    masks[pop_i] = to_mask(pops[pop_i].covered_tasks);
+  }
+  const auto coverage_solutions = dirdevo::solve_max_coverage(masks);
+  emp::vector<SolutionInfo> solutions(coverage_solutions.size());
+  for (size_t sol_i = 0; sol_i < solutions.size(); ++sol_i) {
+    SolutionInfo& sol = solutions[sol_i];
+    sol.num_pops = coverage_solutions[sol_i].num_profiles;
+    sol.max_tasks_covered = coverage_solutions[sol_i].GetCoverage();
+    sol.covered_tasks = to_bits(coverage_solutions[sol_i].covered);
+    sol.pop_idxs = coverage_solutions[sol_i].profiles;
+  }
+
+  // add an n=0 solution to make graphing nicer
+  solutions.emplace_back();
+  return solutions;
+}
+
 int main(int argc, char* argv[]) {
 
   // ==================================================================
@@ -498,38 +589,45 @@ int main(int argc, char* argv[]) {
     output_dir += '/';
   }
 
-  // Read csv file
-  std::ifstream pop_profiles_fstream;
-  pop_profiles_fstream.open(config.POP_PROFILE_FILE());
-  if (!pop_profiles_fstream.is_open()) {
-    std::cout << "Failed fo open population profiles csv file: " << config.POP_PROFILE_FILE() << std::endl;
+  const size_t num_threads_available = (config.NUM_THREADS()) ? config.NUM_THREADS() : (size_t)std::max(1u, std::thread::hardware_concurrency());
+
+  // Read csv file (the file stays mapped until we're done; lines refer to it)
+  dirdevo::CsvReader pop_profiles_reader;
+  if (!pop_profiles_reader.Open(config.POP_PROFILE_FILE())) {
+    std::cout << "Failed fo open population profiles csv file: " << pop_profiles_reader.GetError() << std::endl;
+    return -1;
+  }
+  std::string missing_column;
+  const emp::vector<size_t> pop_profile_columns(pop_profiles_reader.GetColumns(POP_PROFILE_COLUMNS, missing_column));
+  if (!missing_column.empty()) {
+    std::cout << "Population profiles csv file is missing column: " << missing_column << std::endl;
     return -1;
   }
-  csv_data_t lines(read_csv(pop_profiles_fstream));
-  std::cout << "Num lines: " << lines.size() << std::endl;
+  emp::vector<PopProfileLine> lines;
+  const size_t num_lines = read_pop_profiles(pop_profiles_reader, pop_profile_columns, num_threads_available, lines);
+  std::cout << "Num lines: " << num_lines << std::endl;
 
   // Organize lines into metapopulations
   std::unordered_map<size_t, MetapopulationInfo> metapopulations;
-  for (auto& line : lines) {
-    if (line["pop_level"] == "0") {
-      continue; // Skip non-population-level tasks.
-    }
-
+  for (const auto& line : lines) {
     // Build metapop identifier
-    size_t metapop_identifier = emp::from_string<size_t>(line["SEED"]);
+    const size_t metapop_identifier = line.seed;
 
     // If this is the first time we've seen this metapopulation, add it to the set.
-    if (!emp::Has(metapopulations, metapop_identifier)) {
-      metapopulations[metapop_identifier] = MetapopulationInfo(
-        emp::from_string<int>(line["SEED"]),
-        emp::from_string<int>(line["epoch"]),
-        line["SELECTION_METHOD"]
-      );
+    auto metapop_it = metapopulations.find(metapop_identifier);
+    if (metapop_it == metapopulations.end()) {
+      metapop_it = metapopulations.emplace(
+        metapop_identifier,
+        MetapopulationInfo(
+          (int)line.seed,
+          line.epoch,
+          std::string(line.selection_method)
+        )
+      ).first;
     }
 
     // If this is the first time we've seen this population, add it to the set.
-    auto& metapop = metapopulations[metapop_identifier];
-    metapop.AddLine(line);
+    metapop_it->second.AddLine(line.pop_id, line.task_name, line.task_covered);
 
   }
   std::cout << "Metapopulations found: " << metapopulations.size() << std::endl;
@@ -591,12 +689,46 @@ int main(int argc, char* argv[]) {
   );
   output_file.PrintHeaderKeys();
 
-  // Solve each population for each tas
-  // TODO - parallelize!
-  size_t prog_counter = 0;
+  // Solve every metapopulation (each is independent, so they're solved concurrently), then write results in order.
+  emp::vector<std::pair<const size_t, MetapopulationInfo>*> metapop_list;
   for (auto& metapop : metapopulations) {
+    metapop_list.emplace_back(&metapop);
+  }
+  emp::vector< emp::vector<SolutionInfo> > metapop_solutions(metapop_list.size());
+  std::atomic<size_t> next_metapop{0};
+  std::atomic<bool> solutions_match{true};
+  auto solve_metapops = [&]() {
+    for (size_t i = next_metapop++; i < metapop_list.size(); i = next_metapop++) {
+      MetapopulationInfo& metapop = metapop_list[i]->second;
+      metapop_solutions[i] = solver(metapop);
+      if (!config.CHECK_SOLUTIONS()) continue;
+      const emp::vector<SolutionInfo> reference(reference_solver(metapop));
+      emp_assert(reference.size() == metapop_solutions[i].size());
+      for (size_t sol_i = 0; sol_i < reference.size(); ++sol_i) {
+        if (reference[sol_i].max_tasks_covered != metapop_solutions[i][sol_i].max_tasks_covered) {
+          solutions_match = false;
+        }
+      }
+    }
+  };
+  const size_t num_threads = std::min(metapop_list.size(), num_threads_available);
+  emp::vector<std::thread> threads;
+  for (size_t thread_i = 1; thread_i < num_threads; ++thread_i) {
+    threads.emplace_back(solve_metapops);
+  }
+  solve_metapops();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (!solutions_match) {
+    std::cout << "Solutions do not match the reference solver!" << std::endl;
+    return -1;
+  }
+
+  for (size_t metapop_i = 0; metapop_i < metapop_list.size(); ++metapop_i) {
+    auto& metapop = *metapop_list[metapop_i];
     out_metapop_ptr = &(metapop.second);
-    prog_counter += 1;
+    const size_t prog_counter = metapop_i + 1;
     std::cout << "Processing metapopulation ("<<prog_counter<<"/"<< metapopulations.size() <<")" << std::endl;
     //////////////////////////////////////////////////////////////////////////////////////////
     // Print metapopulation info
@@ -608,7 +740,7 @@ int main(int argc, char* argv[]) {
     std::cout << "# pops: " << metapop.second.pops.size() << "; ";
     std::cout << std::endl;
     // Print solutions for each N (num pops)
-    emp::vector<SolutionInfo> solutions(solver(metapop.second));
+    emp::vector<SolutionInfo>& solutions = metapop_solutions[metapop_i];
     for (size_t sol_i = 0; sol_i < solutions.size(); ++sol_i) {
       out_solution_ptr = &solutions[sol_i];
       auto& sol = solutions[sol_i];
@@ -4,6 +4,8 @@
 
 #include <cstddef>
 
+#include "emp/base/vector.hpp"
+
 namespace dirdevo {
 
 /// BaseOrganism exists to remind me & enforce what I require organism classes to implement...
@@ -24,8 +26,6 @@ protected:
 
 public:
 
-  virtual ~BaseOrganism() = default;
-
   double GetMerit() const { return merit; }
   bool GetNewBorn() const { return new_born; }
   bool GetDead() const { return dead; }
@@ -46,28 +46,34 @@ public:
    *   void ProcessStep(WORLD_T & world) {
    *      ....
    *   }
+   *
+   * Derived organisms also need to implement:
+   *   void OnPlacement(size_t position)   // Called when *this* organism is placed (just after birth or injection)
+   *   void OnBirth(DERIVED_T& parent)     // Called when *this* organism is born (when the world's offspring ready
+   *                                       // signal is triggered, after mutations)
    */
 
+  // --- OPTIONAL HOOKS ---
+  // Hooks are not virtual: the world calls them on DERIVED_T directly. Derived organisms shadow the hooks they need;
+  // the world does not call hooks that are left at these (no-op) defaults (see overrides_hook_v).
+
   /// Called when this organism is about to be injected into the population.
-  virtual void OnInjectReady() { emp_assert(false, "Derived task class must implement this function."); }
+  void OnInjectReady() { }
 
   /// Called when this organism is about to reproduce (but offspring has not been built yet)
-  virtual void OnBeforeRepro() { emp_assert(false, "This function must be implemented by derived organism class."); }
+  void OnBeforeRepro() { }
 
   /// Called when this organism's offspring is ready (after the offspring's OnBirth function is called)
-  virtual void OnOffspringReady(DERIVED_T& offspring) { emp_assert(false, "This function must be implemented by derived organism class."); }
-
-  /// Called when *this* organism is placed (just after birth or injection)
-  virtual void OnPlacement(size_t position) { emp_assert(false, "This function must be implemented by derived organism class."); }
+  void OnOffspringReady(DERIVED_T& offspring) { }
 
-  /// Called when *this* organism is born
-  /// - when world's offspring ready signal is triggered
-  /// - after mutations
-  virtual void OnBirth(DERIVED_T& parent) { emp_assert(false, "This function must be implemented by derived organism class."); }
+  /// Called just after *this* organism's genome is mutated, with the mutated sites (see DirectedDevoWorld's
+  /// DoMutationsOrg; organisms that implement this must be paired with a mutator that reports them). Organisms with
+  /// derived state (e.g., a phenotype computed from the genome) can use this to update that state incrementally.
+  void OnMutations(const emp::vector<size_t>& sites) { }
 
   /// Called when *this* organism is being 'killed' by the world (in most cases, this won't do anything)
   /// - Position is the position in the world where the organism is being removed
-  virtual void OnDeath(size_t position) { emp_assert(false, "This function must be implemented by the derived organism class."); }
+  void OnDeath(size_t position) { }
 
 };
 
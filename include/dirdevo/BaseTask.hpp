@@ -12,8 +12,6 @@
 
 namespace dirdevo {
 
-// TODO - at compile time, depending on the task strip out unused function calls from the world?
-
 /// Tasks describe the world-level task. Organism-level "task" (i.e., how organisms reproduce/compete within a world is defined by the organism).
 /// This BaseTask design intends for derived tasks to ONLY work with a dirdevo::DirectedDevoWorld!
 template<typename DERIVED_T, typename ORG_T>
@@ -43,53 +41,66 @@ public:
 
   bool IsEvalFresh() const { return fresh_eval; }
 
-  // --- WORLD-LEVEL EVENT HOOKS ---
+  /// Write the aggregate performance and each sub-task performance (sub_scores must have room for one score per
+  /// function in the performance function set).
+  /// The world calls this on the derived task type, so derived tasks can shadow this to write their scores directly
+  /// (instead of going through the performance functions).
+  void WriteScores(double& aggregate_score, double* sub_scores) {
+    aggregate_score = aggregate_performance_fun();
+    for (size_t i = 0; i < performance_fun_set.size(); ++i) {
+      sub_scores[i] = performance_fun_set[i]();
+    }
+  }
 
-  virtual emp::vector<ConfigSnapshotEntry> GetConfigSnapshotEntries() { return {}; } // By default, return an empty vector.
+  // --- WORLD-LEVEL EVENT HOOKS ---
+  // Hooks are not virtual: the world calls them on DERIVED_T directly. Derived tasks shadow the hooks they need; the
+  // world does not call optional hooks that are left at these (no-op) defaults (see overrides_hook_v).
+  // Derived tasks must implement:
+  //   void OnWorldSetup() // Called at end of constructor/world setup
+  //   void Evaluate()     // Ensure that task performance is up-to-date (might not do anything if performance is
+  //                       // updated as the world updates).
 
-  /// OnWorldSetup called at end of constructor/world setup
-  virtual void OnWorldSetup() { emp_assert(false, "Derived task class must implement this function."); }
+  emp::vector<ConfigSnapshotEntry> GetConfigSnapshotEntries() { return {}; } // By default, return an empty vector.
 
   /// OnBeforeWorldUpdate is called at the beginning of running the world update
-  virtual void OnBeforeWorldUpdate(size_t update) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnBeforeWorldUpdate(size_t update) { }
 
-  /// OnWorldUpdate is called when the OnUpdate signal is triggered (at the end of a world update)
-  virtual void OnWorldUpdate(size_t update) { emp_assert(false, "Derived task class must implement this function."); }
+  /// OnWorldUpdate is called at the end of a world update
+  void OnWorldUpdate(size_t update) { }
 
   /// OnWorldReset is called when the DirectedDevoWorld's DirectedDevoReset function is called.
-  virtual void OnWorldReset() { emp_assert(false, "Derived task class must implement this function."); }
+  void OnWorldReset() { }
 
-  // TODO - any selection based hooks!
-  /// Ensure that task performance is up-to-date. Might not do anything if performance is updated as the world updates.
-  virtual void Evaluate() { emp_assert(false, "Derived task class must implement this function."); }
+  /// Cheap, current world-level score (called after every world update when early stopping is enabled).
+  /// Worlds can only stop early (see EARLY_STOP_UPDATES) if their task implements this.
+  double GetRunningScore() const { return 0.0; }
 
   // --- ORGANISM-LEVEL EVENT HOOKS ---
   // These are always called AFTER the organism's equivalent functions.
 
   /// Called before an organism is injected into the population
-  virtual void OnOrgInjectReady(org_t& org) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnOrgInjectReady(org_t& org) { }
 
-  // NOTE - Asserts are a lazy way to indicate to future me that these functions need to be implemented.
   /// Called when parent is about to reproduce, but before an offspring has been constructed.
-  virtual void OnBeforeOrgRepro(org_t & parent) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnBeforeOrgRepro(org_t & parent) { }
 
   /// Called when the offspring has been constructed but has not been placed yet.
-  virtual void OnOffspringReady(org_t& offspring, org_t& parent) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnOffspringReady(org_t& offspring, org_t& parent) { }
 
   /// Called when org is being placed (@ position) in the world
-  virtual void OnOrgPlacement(org_t& org, size_t position) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnOrgPlacement(org_t& org, size_t position) { }
 
   /// Called just before the organism's process step function is called.
-  virtual void BeforeOrgProcessStep(org_t& org) { emp_assert(false, "Derived task class must implement this function."); }
+  void BeforeOrgProcessStep(org_t& org) { }
 
   /// Called just after the organism's process step function is called.
-  virtual void AfterOrgProcessStep(org_t& org) { emp_assert(false, "Derived task class must implement this function."); }
+  void AfterOrgProcessStep(org_t& org) { }
 
   /// Called before organism is removed from the world.
-  virtual void OnOrgDeath(org_t& org, size_t position) { emp_assert(false, "Derived task class must implement this function."); }
+  void OnOrgDeath(org_t& org, size_t position) { }
 
   /// Called after two organisms are swapped in the world (new world positions are accurate).
-  virtual void AfterOrgSwap(org_t& org1, org_t& org2) { emp_assert(false, "Derived task class must implement this function."); }
+  void AfterOrgSwap(org_t& org1, org_t& org2) { }
 
 };
 
@@ -8,20 +8,29 @@ namespace dirdevo {
 
 EMP_BUILD_CONFIG(DirectedDevoConfig,
   GROUP(GLOBAL_SETTINGS, "Global settings"),
+  VALUE(EXPERIMENT_SETUP, std::string, "avidagp-multipathway", "Which experiment setup should be run? Options: avidagp-multipathway, onemax-64, onemax-256, onemax-1024, avidagp-ec (avidagp-ec has its own configuration; select it on the command line)"),
   VALUE(SEED, int, -1, "Seed for a simulation"),
   VALUE(NUM_POPS, size_t, 1, "Number of populations. Must be > 0"),
   VALUE(EPOCHS, size_t, 100, "Number of iterations of population-level selection to perform."),
   VALUE(LOAD_ANCESTOR_FROM_FILE, bool, false, "Should the ancestral genome be loaded from file? NOTE - the experiment setup must implement this functionality."),
   VALUE(ANCESTOR_FILE, std::string, "ancestor.gen", "Path to file containing ancestor genome to be loaded"),
+  VALUE(ANCESTOR_LIBRARY_FILE, std::string, "", "Genome library (e.g., from OUTPUT_POPULATION_LIBRARY) to seed worlds from, instead of a common ancestor. World i is seeded from library slice (i mod number of slices). Empty = don't use a library"),
+  VALUE(ANCESTOR_LIBRARY_SEEDING, std::string, "population", "How is each world seeded from its ancestor library slice? Options: population (every genome in the slice, up to the world size), ancestor (one genome chosen at random from the slice)"),
+  VALUE(NUM_THREADS, size_t, 1, "Number of worker threads used to run worlds (only used when compiled with DIRDEVO_THREADING). 0 = one per hardware thread (one thread if tracking systematics)"),
 
   GROUP(OUTPUT_SETTINGS, "Settings specific to experiment output"),
   VALUE(OUTPUT_DIR, std::string, "output", "Where should the experiment dump output?"),
   VALUE(OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY, bool, true, "Collect world update summary data?"),
   VALUE(OUTPUT_SUMMARY_EPOCH_RESOLUTION, size_t, 1, "Epoch resolution for recording summary data"),
   VALUE(OUTPUT_SUMMARY_UPDATE_RESOLUTION, size_t, 100, "Output resolution for recording summary data"),
-  VALUE(OUTPUT_PHYLOGENY_SNAPSHOT_EPOCH_RESOLUTION, size_t, 10, "How often to output a snapshot of the phylogeny?"),
+  VALUE(OUTPUT_PHYLOGENY_FORMAT, std::string, "snapshot", "How is the phylogeny written? Options: snapshot (full phylogeny_<epoch>.csv snapshots), events (opt-in; append-only phylogeny_events.csv, rebuild snapshots with scripts/reconstruct_phylogeny.py)"),
+  VALUE(OUTPUT_PHYLOGENY_SNAPSHOT_EPOCH_RESOLUTION, size_t, 10, "(snapshot phylogeny format) How often to output a snapshot of the phylogeny?"),
   VALUE(OUTPUT_SYSTEMATICS_EPOCH_RESOLUTION, size_t, 1, "Interval (in epochs) to output to systematics file"),
+  VALUE(OUTPUT_POPULATION_LIBRARY, bool, false, "Write every world's final population to a genome library (population_library.ddgl; one slice per world) that ANCESTOR_LIBRARY_FILE can seed later runs from"),
+  VALUE(OUTPUT_COVERAGE_ANALYSIS, bool, false, "At each recorded epoch (see OUTPUT_SUMMARY_EPOCH_RESOLUTION), find which objectives each world covers and, for every n, the most objectives any n worlds cover together; written to coverage.csv"),
+  VALUE(OUTPUT_COVERAGE_THRESHOLD, double, 50, "(coverage analysis) A world covers an objective when its score on that objective (as in world_evaluation.csv) is at least this. NOTE - avidagp-multipathway scores are completion count times the task's world-level value, so this only thresholds raw counts when task values are 1"),
   VALUE(TRACK_SYSTEMATICS, bool, true, "Should we enable systematics tracking?"),
+  VALUE(SYSTEMATICS_PAIRWISE_DISTANCE_SAMPLES, size_t, 0, "Number of random pairs of active taxa to measure for the systematics file's pairwise distance stats (0 = measure every pair; cost grows quadratically with the number of taxa)"),
 
   GROUP(LOCAL_WORLD_SETTINGS, "Settings for each local population (world)"),
   VALUE(AVG_STEPS_PER_ORG, size_t, 30, "On average, how many steps per organism do we allot on each world update? Must be >= 1."),
@@ -30,14 +39,23 @@ EMP_BUILD_CONFIG(DirectedDevoConfig,
   VALUE(LOCAL_GRID_WIDTH, size_t, 10, "Grid width"),
   VALUE(LOCAL_GRID_HEIGHT, size_t, 10, "Grid height"),
   VALUE(LOCAL_GRID_DEPTH, size_t, 10, "Grid depth (only used in grid3d mode)"),
+  VALUE(EARLY_STOP_UPDATES, size_t, 0, "Stop running a world for the rest of an epoch once its score has not changed for this many updates (requires a task that reports a running score). 0 = never stop early"),
 
   GROUP(POPULATION_SELECTION_SETTINGS, "Settings for selecting populations to propagate"),
-  VALUE(SELECTION_METHOD, std::string, "elite", "Which algorithm should be used to select populations to propagate? Options: elite, tournament"),
+  VALUE(SELECTION_METHOD, std::string, "elite", "Which algorithm should be used to select populations to propagate? Options: elite, tournament, lexicase, epsilon-lexicase, non-dominated-elite, non-dominated-tournament, non-dominated-sorting, random, none"),
   VALUE(ELITE_SEL_NUM_ELITES, size_t, 1, "(elite selection) The top ELITE_SEL_NUM_ELITES populations are propagated"),
-  VALUE(TOURNAMENT_SEL_TOURN_SIZE, size_t, 4, "(tournament selection) How large are tournaments?"),
+  VALUE(TOURNAMENT_SEL_TOURN_SIZE, size_t, 4, "(tournament, non-dominated-tournament, non-dominated-sorting selection) How large are tournaments?"),
+  VALUE(LEXICASE_EPSILON, double, -1.0, "(epsilon-lexicase selection) Populations within epsilon of the best score on a function survive filtering on that function. Negative = use each function's median absolute deviation"),
   VALUE(POPULATION_SAMPLING_METHOD, std::string, "random", "What method to use when sampling genomes to form propagules? Options: random, full"),
   VALUE(POPULATION_SAMPLING_SIZE, size_t, 1, "How many genomes to sample from each population when forming propagules (after population selection)?"),
 
+  GROUP(DISTRIBUTED_SETTINGS, "Settings for splitting an experiment's worlds across multiple cooperating processes (island model)"),
+  VALUE(DISTRIBUTED_NUM_PROCS, size_t, 1, "Number of cooperating processes. Each process runs a contiguous block of worlds. 1 = single process."),
+  VALUE(DISTRIBUTED_RANK, size_t, 0, "Rank of this process (0 to DISTRIBUTED_NUM_PROCS-1). Rank 0 coordinates communication and writes experiment-level output."),
+  VALUE(DISTRIBUTED_TRANSPORT, std::string, "unix-socket", "How do processes communicate? Options: unix-socket"),
+  VALUE(DISTRIBUTED_ENDPOINT, std::string, "dirdevo.sock", "Transport endpoint (for unix-socket: path to the socket file; all ranks must use the same path)"),
+  VALUE(DISTRIBUTED_TIMEOUT, size_t, 60, "How long (in seconds) should processes wait for each other to connect?"),
+
   GROUP(BITSET_GENOME_SETTINGS, "Settings specific to bitset genomes"),
   VALUE(BITSET_MUTATOR_PER_SITE_SUBSTITUTION_RATE, double, 0.01, "Per-site substitution rate for bitset genomes"),
   // GROUP(ONEMAX_ORG_SETTINGS, "Settings specific to the onemax organism"),
@@ -2,18 +2,32 @@
  * @file DirectedDevoExperiment.hpp
  * @brief Defines and manages a directed evolution experiment.
  *
- * DIRDEVO_THREADING
+ * DIRDEVO_THREADING - run worlds on a pool of NUM_THREADS worker threads (each worker pulls the next world to run).
+ *   With one thread (NUM_THREADS=1, the default, or NUM_THREADS=0 while tracking systematics), worlds run in order on
+ *   the main thread, exactly as in a build without threading. Worlds buffer their summary rows, which are written in
+ *   world order after every world has run, so output files don't depend on the number of threads.
+ *
+ * DIRDEVO_INSTRUMENTATION - collect hot path counters and per-epoch phase timings (written to performance.csv).
+ *
+ * Worlds can be split across multiple cooperating processes (see DISTRIBUTED_SETTINGS). Each process runs
+ * a contiguous block of worlds; scores are exchanged at selection time and propagule genomes at transfer time.
+ *
+ * Each world draws from its own keyed random number stream (see utility/Philox.hpp), so results for a given SEED
+ * don't depend on thread count, on how worlds are split across processes, or on whether threading is enabled.
  */
 
 #pragma once
 #ifndef DIRECTED_DEVO_DIRECTED_DEVO_EXPERIMENT_HPP_INCLUDE
 #define DIRECTED_DEVO_DIRECTED_DEVO_EXPERIMENT_HPP_INCLUDE
 
+#include <algorithm>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
 #include <filesystem>
+#include <type_traits>
 #include <sys/stat.h>
 
 #include "emp/base/vector.hpp"
@@ -30,8 +44,21 @@
 #include "selection/BaseSelect.hpp"
 #include "utility/ConfigSnapshotEntry.hpp"
 #include "utility/WorldAwareDataFile.hpp"
+#include "utility/ByteBuffer.hpp"
+#include "utility/ScoreMatrix.hpp"
+#include "utility/PerformanceCounters.hpp"
+#include "utility/PhylogenyEventLog.hpp"
+#include "utility/GenotypeFingerprint.hpp"
+#include "utility/PairwiseDistanceSampler.hpp"
+#include "utility/Philox.hpp"
+#include "utility/GenomeLibrary.hpp"
+#include "utility/max_coverage.hpp"
+#include "distributed/BaseTransport.hpp"
+#include "distributed/LocalTransport.hpp"
+#include "distributed/UnixSocketTransport.hpp"
 
 #ifdef DIRDEVO_THREADING
+#include <atomic>
 #include <thread>
 #include <mutex>
 #endif // DIRDEVO_THREADED
@@ -41,8 +68,6 @@ namespace dirdevo {
 // TODO - we're using one uniform configuration type, so just hand off configs and let things configure themselves.
 // TODO - make communication between experiment and components more consistent (e.g., Configuration; let components configure themselves?)
 
-const size_t MAX_WORLD_SEED = 100000;
-
 // PERIPHERAL defines any extra equipment needed to run the experiment (typically something required by the subtasks)
 template<typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL=BasePeripheral>
 class DirectedDevoExperiment {
@@ -64,14 +89,19 @@ public:
   using propagule_t = emp::vector<TransferOrg>;
 
   // TODO - add mutation tracking to systematics?
-  using systematics_t = emp::Systematics<org_t, genome_t>;
+  // Taxa are keyed by a 64-bit genome fingerprint rather than a full copy of the genome (see GenotypeFingerprint.hpp).
+  using systematics_t = emp::Systematics<org_t, genotype_fingerprint_t>;
+  using phylogeny_log_t = PhylogenyEventLog<systematics_t, org_t>;
+  using distance_sampler_t = PairwiseDistanceSampler<systematics_t>;
 
   const std::unordered_set<std::string> valid_selection_methods={
     "elite",
     "tournament",
     "lexicase",
+    "epsilon-lexicase",
     "non-dominated-elite",
     "non-dominated-tournament",
+    "non-dominated-sorting",
     "random",
     "none"
   };
@@ -81,6 +111,20 @@ public:
     "full"
   };
 
+  const std::unordered_set<std::string> valid_distributed_transports={
+    "unix-socket"
+  };
+
+  const std::unordered_set<std::string> valid_phylogeny_formats={
+    "events",
+    "snapshot"
+  };
+
+  const std::unordered_set<std::string> valid_ancestor_library_seeding={
+    "population",
+    "ancestor"
+  };
+
   /// Propagules are vectors of TransferGenomes. A TransferGenome wraps information about the genomes sampled to form propagules.
   /// Necessary for stitching together phylogeny tracking across transfers.
   struct TransferOrg {
@@ -92,37 +136,69 @@ public:
 protected:
 
   const config_t& config;                  ///< Experiment configuration (REMINDER: the config object must exist beyond lifetime of this experiment object!)
+  /// Purposes of per-world random number streams (each world has one stream per purpose per epoch)
+  enum WorldStream : uint32_t { WORLD_STREAM_SETUP=0, WORLD_STREAM_EPOCH };
+
   emp::Random random;                      ///< Experiment-level random number generator.
-  emp::vector<emp::Random> world_rngs;    ///< To minimize shared memory resources between worlds (for threading), each world gets its own (uniquely seeded) random number generator.
+  emp::vector<emp::Random> world_rngs;    ///< Each world's random number generator (reseeded from that world's stream each epoch; see WORLD_STREAM_EPOCH)
+  emp::vector<int> world_seeds;            ///< Seed of every world's current stream (indexed by world id; unique across worlds)
+  uint64_t stream_key=0;                   ///< Key for per-world random number streams (drawn from random, so it's determined by SEED)
 
-  emp::vector<emp::Ptr<world_t>> worlds;   ///< How many "populations" are we applying directed evolution to?
+  emp::vector<emp::Ptr<world_t>> worlds;   ///< Worlds run by this process (all worlds, unless distributed). worlds[i] has world id first_world_id+i.
+  size_t first_world_id=0;                 ///< World id of the first world run by this process.
+
+  emp::Ptr<BaseTransport> transport=nullptr; ///< Moves scores/propagules between cooperating processes.
 
   pop_struct_t local_pop_struct=pop_struct_t::MIXED;
   // mutator_t mutator;
   emp::vector<mutator_t> mutators;                 ///< One mutator per world. (to avoid shared memory resources for threading)
   peripheral_t peripheral;                      ///< Peripheral components that should exist at the experiment level.
   emp::Ptr<systematics_t> systematics=nullptr;  ///< Phylogeny tracking
+  emp::Ptr<phylogeny_log_t> phylogeny_log=nullptr; ///< Append-only phylogeny output (if OUTPUT_PHYLOGENY_FORMAT is events)
+  emp::Ptr<distance_sampler_t> distance_sampler=nullptr; ///< Sampled pairwise distances (if SYSTEMATICS_PAIRWISE_DISTANCE_SAMPLES > 0)
 
   emp::Ptr<BaseSelect> selector=nullptr;
 
   std::function<emp::vector<size_t>&(void)> do_selection_fun;
-  emp::vector<std::function<double(void)>> aggregate_score_funs;          ///< One function for each world.
-  emp::vector< emp::vector<std::function<double(void)>> > score_fun_sets; ///< One set of functions for each world. Where each function corresponds to a single objective.
+  emp::vector<double> aggregate_scores;                 ///< Aggregate score for every world in the experiment (indexed by world id; refreshed each epoch).
+  ScoreMatrix scores;                                   ///< Per-objective scores for every world in the experiment (one row per world id, one column per objective).
+  emp::vector<bool> world_extinct;                      ///< Extinction status of every world in the experiment (indexed by world id).
 
   std::function<void(world_t&,propagule_t&)> propagule_sample_fun;
   emp::vector<propagule_t> propagules;
   std::unordered_set<size_t> extinct_worlds;        ///< Set of worlds that are extinct.
   std::unordered_set<size_t> live_worlds;           ///< Set of worlds that are not extinct.
-  emp::vector<size_t> population_sample_order;
+  emp::vector< emp::vector<size_t> > population_sample_orders; ///< One for each world run by this process (so sampling from a world depends only on that world's history).
 
   size_t max_world_size=0;
   bool setup=false;
   size_t cur_epoch=0;
   bool record_epoch=false;
+  size_t num_threads=1;                    ///< Threads used to run worlds (1 = run worlds in order on the main thread)
 
   emp::Ptr<world_aware_data_file_t> world_summary_file=nullptr;     ///< Manages world update summary output. (is updated during world updates; for each world)
+  emp::vector<std::ostringstream> world_summary_buffers;            ///< Each local world's summary rows for the current epoch
+  emp::vector<emp::Ptr<world_aware_data_file_t>> world_summary_buffer_files; ///< Each local world's summary file (writes to its buffer)
   emp::Ptr<emp::DataFile> world_evaluation_file=nullptr;  ///< Manages world evaluation output. (is updated after each world's evaluation)
   emp::Ptr<emp::DataFile> world_systematics_file=nullptr; ///<
+  emp::Ptr<world_aware_data_file_t> early_stop_file=nullptr;  ///< One row per world that stopped early (per epoch)
+  emp::Ptr<emp::DataFile> coverage_file=nullptr;          ///< Coverage analysis output (if OUTPUT_COVERAGE_ANALYSIS); one row per number of worlds per recorded epoch
+
+  task_mask_t metapop_coverage=0;                         ///< Objectives covered by any world (as of the last coverage analysis)
+  emp::vector<MaxCoverageSolution> coverage_solutions;    ///< coverage_solutions[n-1] = best coverage by n worlds (as of the last coverage analysis)
+  size_t cur_coverage_solution=0;                         ///< Coverage solution being written to the coverage file
+
+  static constexpr size_t NO_EARLY_STOP = (size_t)-1;
+  emp::vector<size_t> early_stop_updates;                 ///< Update at which each local world stopped early this epoch (NO_EARLY_STOP if it didn't)
+
+  #ifdef DIRDEVO_INSTRUMENTATION
+  /// Epoch phases timed by instrumentation.
+  enum Phase : size_t { PHASE_SIMULATE=0, PHASE_EVALUATE, PHASE_SELECT, PHASE_SAMPLE, PHASE_RESEED, PHASE_OUTPUT, NUM_PHASES };
+  const emp::vector<std::string> phase_names={"simulate", "evaluate", "select", "sample", "reseed", "output"};
+  PhaseTimer phase_timer{NUM_PHASES};
+  emp::vector<WorldPerfCounters> epoch_world_counters;  ///< Counters for each world run by this process (for the current epoch).
+  emp::Ptr<emp::DataFile> performance_file=nullptr;     ///< Manages performance output (one line per epoch).
+  #endif // DIRDEVO_INSTRUMENTATION
 
   std::string output_dir;                     ///< Formatted output directory
 
@@ -132,14 +208,18 @@ protected:
   /// Configure local population structure (called internally).
   // void SetLocalPopStructure();
 
+  /// Configure communication with cooperating processes (called internally).
+  void SetupTransport();
+
   /// Configure population selection (called internally).
   void SetupSelection();
   void SetupSystematics();
   void SetupEliteSelection();
   void SetupTournamentSelection();
-  void SetupLexicaseSelection();
+  void SetupLexicaseSelection(double epsilon);
   void SetupNonDominatedEliteSelection();
   void SetupNonDominatedTournamentSelection();
+  void SetupNonDominatedSortingSelection();
   void SetupRandomSelection();
   void SetupNoSelection();
 
@@ -155,6 +235,51 @@ protected:
 
   void SeedWithPropagule(world_t& world, propagule_t& propagule);
 
+  /// Seed each world from its slice of the ancestor genome library (ANCESTOR_LIBRARY_FILE). Slices are decoded in
+  /// parallel (when threading) straight from the memory-mapped library.
+  void SeedFromLibrary();
+
+  /// Write every (local) world's population to a genome library, one slice per world.
+  void WritePopulationLibrary();
+
+  /// Find which objectives each world covers (straight from the score table, so this sees every world, even those run
+  /// by other processes) and the most objectives that any n worlds cover, for every n. Writes to the coverage file.
+  /// A world covers an objective when its score (as in world_evaluation.csv) is at least OUTPUT_COVERAGE_THRESHOLD.
+  /// For avidagp-multipathway, that score is the task's completion count times its world-level value (the same scores
+  /// the analysis scripts' trait coverage thresholds); it's the raw count only when the task's value is 1.
+  void AnalyzeCoverage();
+
+  /// Run the given world for one epoch (UPDATES_PER_EPOCH+1 updates). Once a world goes extinct (nothing can happen
+  /// in it for the rest of the epoch) or its score plateaus (see EARLY_STOP_UPDATES), its remaining updates are
+  /// skipped (still writing any per-update summary rows).
+  void RunWorldEpoch(world_t& world, bool record_updates);
+
+  /// First update (>= u) in this epoch that gets a world summary row (UPDATES_PER_EPOCH+1 if there are none).
+  size_t NextSummaryUpdate(size_t u) const;
+
+  /// Write every local world's buffered summary rows for this epoch to world_summary.csv (in world order, so output
+  /// doesn't depend on which thread ran which world, or when), then clear the buffers.
+  void WriteWorldSummaries();
+
+  /// Delete the per-world summary buffers (and the data files that write to them).
+  void DeleteWorldSummaryBuffers();
+
+  /// Is the experiment split across multiple processes?
+  bool IsDistributed() const { return transport->GetNumRanks() > 1; }
+
+  /// Is the world with the given id run by this process?
+  bool IsLocalWorld(size_t world_id) const { return (world_id >= first_world_id) && (world_id < first_world_id + worlds.size()); }
+
+  /// Copy the given (evaluated) world's scores into the experiment's score tables.
+  void RecordWorldScores(world_t& world);
+
+  /// Share this process's world scores with all other processes (no-op when not distributed).
+  void ExchangeScores();
+
+  /// Send propagules sampled for worlds run by other processes, receive propagules for worlds run by this process.
+  /// (no-op when not distributed)
+  void ExchangePropagules(const std::string& outgoing);
+
   /// Output the experiment's configuration as a .csv file.
   void SnapshotConfig(const std::string& filename = "experiment-config.csv");
 
@@ -174,15 +299,20 @@ public:
 
   ~DirectedDevoExperiment() {
     // Clean up worlds
-    aggregate_score_funs.clear();
     for (auto world : worlds) {
       if (world != nullptr) world.Delete();
     }
 
     // Clean up data files
     if (world_summary_file) world_summary_file.Delete();
+    DeleteWorldSummaryBuffers();
     if (world_evaluation_file) world_evaluation_file.Delete();
     if (world_systematics_file) world_systematics_file.Delete();
+    if (early_stop_file) early_stop_file.Delete();
+    if (coverage_file) coverage_file.Delete();
+    #ifdef DIRDEVO_INSTRUMENTATION
+    if (performance_file) performance_file.Delete();
+    #endif // DIRDEVO_INSTRUMENTATION
 
     // Clean up any undeleted propagule organism pointers
     for (propagule_t& propagule : propagules) {
@@ -191,11 +321,16 @@ public:
       }
     }
 
-    // Clean up the shared (between worlds) systematics manager
+    // Clean up the shared (between worlds) systematics manager (and the phylogeny log that listens to it)
+    if (phylogeny_log) phylogeny_log.Delete();
+    if (distance_sampler) distance_sampler.Delete();
     if (systematics) systematics.Delete();
 
     // Clean up the selector
     if (selector) selector.Delete();
+
+    // Clean up the transport (last; closes connections to other processes)
+    if (transport) transport.Delete();
   }
 
   /// Run experiment for configured number of EPOCHS
@@ -215,10 +350,6 @@ template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typenam
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Setup() {
   if (setup) return; // Don't let myself run Setup more than once.
 
-  #ifdef DIRDEVO_THREADING
-  std::cout << "Compiled with threading enabled." << std::endl;
-  #endif // DIRDEVO_THREADING
-
   // Validate configuration (even in when compiled outside of debug mode!)
   if(!ValidateConfig()) {
     // todo - report which configs are invalid?
@@ -226,13 +357,30 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Setup() {
     std::exit(EXIT_FAILURE);
   }
 
+  #ifdef DIRDEVO_THREADING
+  // Systematics tracking isn't thread-safe, so only use every hardware thread by default if we're not tracking.
+  if (config.NUM_THREADS()) {
+    num_threads = config.NUM_THREADS();
+  } else {
+    num_threads = (config.TRACK_SYSTEMATICS()) ? 1 : (size_t)std::max(1u, std::thread::hardware_concurrency());
+  }
+  std::cout << "Compiled with threading enabled (" << num_threads << " threads)." << std::endl;
+  #endif // DIRDEVO_THREADING
+
   // What population structure are we using?
   // TODO - clean this up a bit!
   // local_pop_struct = world_t::PopStructureStrToMode(config.LOCAL_POP_STRUCTURE());
   // typename world_t::PopStructureDesc pop_struct(local_pop_struct, config.LOCAL_GRID_WIDTH(), config.LOCAL_GRID_HEIGHT(), config.LOCAL_GRID_DEPTH());
 
+  // Connect to any cooperating processes, figure out which worlds this process is responsible for.
+  SetupTransport();
+  const size_t rank = transport->GetRank();
+  const size_t num_ranks = transport->GetNumRanks();
+  first_world_id = (rank * config.NUM_POPS()) / num_ranks;
+  const size_t num_local_worlds = (((rank + 1) * config.NUM_POPS()) / num_ranks) - first_world_id;
+
   // Configure the mutator
-  mutators.resize(config.NUM_POPS());
+  mutators.resize(num_local_worlds);
   for (auto& mutator : mutators) {
     mutator_t::Configure(mutator, config);
   }
@@ -240,66 +388,68 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Setup() {
   // Configure the peripheral components
   peripheral.Setup(config);
 
-  #ifdef DIRDEVO_THREADING
-  // NOTE - if number of populations is close to max world seed, this loop might take a really long time...
-  emp_assert(MAX_WORLD_SEED > config.NUM_POPS());
-  std::unordered_set<size_t> world_seeds;
-  while (world_seeds.size() < config.NUM_POPS()) {
-    world_seeds.emplace(random.GetUInt());
+  // Each world gets its own random number generator, seeded from a stream keyed on (world id, epoch, purpose).
+  // A world's random numbers don't depend on which thread or process runs it (or on what other worlds do), so results
+  // are identical for serial, threaded, and distributed runs with the same SEED.
+  stream_key = ((uint64_t)random.GetUInt() << 32) | random.GetUInt();
+  world_seeds = unique_stream_seeds(stream_key, (uint32_t)config.NUM_POPS(), 0, WORLD_STREAM_SETUP);
+  world_rngs.clear();
+  world_rngs.reserve(num_local_worlds); // Worlds hold references to their generators.
+  for (size_t i = 0; i < num_local_worlds; ++i) {
+    world_rngs.emplace_back(world_seeds[first_world_id + i]);
   }
-  for (auto seed : world_seeds) {
-    world_rngs.emplace_back(seed);
-  }
-  #endif // DIRDEVO_THREADING
 
-  // Initialize each world.
-  worlds.resize(config.NUM_POPS());
+  // Initialize each world run by this process.
+  worlds.resize(num_local_worlds);
   max_world_size=0;
-  for (size_t i = 0; i < config.NUM_POPS(); ++i) {
+  for (size_t i = 0; i < num_local_worlds; ++i) {
+    const size_t world_id = first_world_id + i;
     worlds[i] = emp::NewPtr<world_t>(
       config,
-      #ifdef DIRDEVO_THREADING
       world_rngs[i],
-      #else
-      random,
-      #endif // DIRDEVO_THREADING
-      "world_"+emp::to_string(i),
-      i
+      "world_"+emp::to_string(world_id),
+      world_id
     );
     worlds[i]->SetAvgOrgStepsPerUpdate(config.AVG_STEPS_PER_ORG());
     // configure world's mutation function
-    worlds[i]->SetMutFun([this, i](org_t & org, emp::Random& rnd) {
-      // TODO - add support for mutation tracking!
-      return mutators[i].Mutate(org.GetGenome(), rnd);
-    });
+    worlds[i]->SetMutator(mutators[i]); // (mutators is never resized after this)
     max_world_size = emp::Max(worlds[i]->GetSize(), max_world_size);
   }
 
+  // Some settings can only be checked against the worlds (e.g., against their number of objectives).
+  if(!ValidateConfig()) {
+    std::cout << "Invalid configuration, exiting." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   if (config.TRACK_SYSTEMATICS()) {
     SetupSystematics();
   }
 
-  // Seed each world with an initial common ancestor
+  // Seed each world from its slice of an ancestor library, or with an initial common ancestor
   // PROBLEM - can't do out-of-world injection for genomes
-  for (auto world_ptr : worlds) {
-    std::function<genome_t(this_t&, world_t&)> get_ancestor_genome;
-    // TODO - Make ancestor loading a little smarter? E.g., allow different ancestors for different worlds? Can hack into the load function (using the world name to differentiate).
-    if (config.LOAD_ANCESTOR_FROM_FILE()) {
-      // check that file exists
-      if (!std::filesystem::exists(config.ANCESTOR_FILE())) {
-        std::cout << "Ancestor file does not exist. " << config.ANCESTOR_FILE() << std::endl;
-        std::exit(EXIT_FAILURE);
+  if (config.ANCESTOR_LIBRARY_FILE() != "") {
+    SeedFromLibrary();
+  } else {
+    for (auto world_ptr : worlds) {
+      std::function<genome_t(this_t&, world_t&)> get_ancestor_genome;
+      if (config.LOAD_ANCESTOR_FROM_FILE()) {
+        // check that file exists
+        if (!std::filesystem::exists(config.ANCESTOR_FILE())) {
+          std::cout << "Ancestor file does not exist. " << config.ANCESTOR_FILE() << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        get_ancestor_genome = [](this_t& experiment, world_t& world) {
+          return org_t::LoadAncestralGenome(experiment, world);
+        };
+      } else {
+        get_ancestor_genome = [](this_t& experiment, world_t& world) {
+          return org_t::GenerateAncestralGenome(experiment, world);
+        };
       }
-      get_ancestor_genome = [](this_t& experiment, world_t& world) {
-        return org_t::LoadAncestralGenome(experiment, world);
-      };
-    } else {
-      get_ancestor_genome = [](this_t& experiment, world_t& world) {
-        return org_t::GenerateAncestralGenome(experiment, world);
-      };
+      // auto ancestral_genome = ;
+      world_ptr->InjectAt(get_ancestor_genome(*this, *world_ptr), 0); // TODO - Random location to start?
     }
-    // auto ancestral_genome = ;
-    world_ptr->InjectAt(get_ancestor_genome(*this, *world_ptr), 0); // TODO - Random location to start?
   }
 
   // Adjust initial scheduler weights according to initial population!
@@ -322,45 +472,54 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Setup() {
 }
 
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
-void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupSelection() {
-
-  // Wire up aggregate score functions
-  aggregate_score_funs.clear();
-  for (size_t pop_id = 0; pop_id < config.NUM_POPS(); ++pop_id) {
-    aggregate_score_funs.emplace_back(
-      [this, pop_id]() {
-        return worlds[pop_id]->GetAggregateTaskPerformance();
-      }
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupTransport() {
+  if (config.DISTRIBUTED_NUM_PROCS() == 1) {
+    transport = emp::NewPtr<LocalTransport>();
+  } else if (config.DISTRIBUTED_TRANSPORT() == "unix-socket") {
+    std::cout << "Rank " << config.DISTRIBUTED_RANK() << " of " << config.DISTRIBUTED_NUM_PROCS();
+    std::cout << " connecting via " << config.DISTRIBUTED_ENDPOINT() << std::endl;
+    transport = emp::NewPtr<UnixSocketTransport>(
+      config.DISTRIBUTED_ENDPOINT(),
+      config.DISTRIBUTED_RANK(),
+      config.DISTRIBUTED_NUM_PROCS(),
+      config.DISTRIBUTED_TIMEOUT()
     );
+  } else {
+    // code should never reach this else (unless I forget to add a transport here that is in the valid transport set)
+    emp_assert(false, "Unimplemented transport.", config.DISTRIBUTED_TRANSPORT());
   }
+}
 
-  // Wire up function sets
-  score_fun_sets.clear();
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupSelection() {
+
+  // Selection schemes read world scores straight from the experiment's score buffers (worlds write into them after
+  // they are evaluated). This way, selection sees every world's scores, even those run by other processes.
   std::unordered_set<size_t> fun_set_sizes;
-  for (size_t pop_id = 0; pop_id < config.NUM_POPS(); ++pop_id) {
-    score_fun_sets.emplace_back();
-    const size_t fun_set_size = worlds[pop_id]->GetNumSubTasks();
-    fun_set_sizes.emplace(fun_set_size);
-    for (size_t fun_i = 0; fun_i < worlds[pop_id]->GetNumSubTasks(); ++fun_i) {
-      score_fun_sets[pop_id].emplace_back(
-        [this, pop_id, fun_i] () {
-          return worlds[pop_id]->GetSubTaskPerformance(fun_i);
-        }
-      );
-    }
+  for (auto world_ptr : worlds) {
+    fun_set_sizes.emplace(world_ptr->GetNumSubTasks());
   }
   emp_assert(fun_set_sizes.size() == 1, "Not all worlds have same number of sub task performance functions");
+  const size_t num_objectives = worlds[0]->GetNumSubTasks();
+  aggregate_scores.resize(config.NUM_POPS(), 0.0);
+  scores.Resize(config.NUM_POPS(), num_objectives);
+  scores.Fill(0.0);
+  world_extinct.resize(config.NUM_POPS(), false);
 
   if (config.SELECTION_METHOD() == "elite") {
     SetupEliteSelection();
   } else if (config.SELECTION_METHOD() == "tournament") {
     SetupTournamentSelection();
   } else if (config.SELECTION_METHOD() == "lexicase") {
-    SetupLexicaseSelection();
+    SetupLexicaseSelection(0.0);
+  } else if (config.SELECTION_METHOD() == "epsilon-lexicase") {
+    SetupLexicaseSelection(config.LEXICASE_EPSILON());
   } else if (config.SELECTION_METHOD() == "non-dominated-elite") {
     SetupNonDominatedEliteSelection();
   } else if (config.SELECTION_METHOD() == "non-dominated-tournament") {
     SetupNonDominatedTournamentSelection();
+  } else if (config.SELECTION_METHOD() == "non-dominated-sorting") {
+    SetupNonDominatedSortingSelection();
   } else if (config.SELECTION_METHOD() == "random") {
     SetupRandomSelection();
   } else if (config.SELECTION_METHOD() == "none") {
@@ -374,17 +533,22 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupSelecti
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupPropaguleSampleMethod() {
 
-  population_sample_order.resize(max_world_size);
-  std::iota(
-    population_sample_order.begin(),
-    population_sample_order.end(),
-    0
-  );
+  population_sample_orders.resize(worlds.size());
+  for (auto& population_sample_order : population_sample_orders) {
+    population_sample_order.resize(max_world_size);
+    std::iota(
+      population_sample_order.begin(),
+      population_sample_order.end(),
+      0
+    );
+  }
 
   if (config.POPULATION_SAMPLING_METHOD() == "random") {
     // Sample randomly
     propagule_sample_fun = [this](world_t& world, propagule_t& sample_into) {
       sample_into.clear();
+      emp_assert(IsLocalWorld(world.GetWorldID()));
+      auto& population_sample_order = population_sample_orders[world.GetWorldID() - first_world_id];
       emp::Shuffle(world.GetRandom(), population_sample_order);
       // extinct worlds shouldn't get selected (unless everything went extinct or we're doing random selection...)
       for (size_t i = 0; (i < population_sample_order.size()) && (sample_into.size() < config.POPULATION_SAMPLING_SIZE()); ++i) {
@@ -421,10 +585,33 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupPropagu
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupSystematics() {
   // Configure systematics tracking (TODO - allow systematics tracking to be stripped out for performance)
-  systematics = emp::NewPtr<systematics_t>([](const org_t& org) { return org.GetGenome(); });
+  // Taxa hold a genome fingerprint (not a genome), so per-taxon memory doesn't grow with genome size.
+  // The storage flags are Empirical's defaults (spelled out here because the phylogeny outputs depend on them): extinct
+  // taxa are pruned once they have no living descendants, and pruned taxa aren't archived. Ancestor chains are not
+  // collapsed, so the number of stored taxa is still bounded only by the living lineages.
+  systematics = emp::NewPtr<systematics_t>(
+    [](const org_t& org) { return genotype_fingerprint<org_t>(org.GetGenome()); },
+    true,   // store_active
+    true,   // store_ancestors
+    false,  // store_all (don't archive pruned taxa)
+    true    // store_pos
+  );
   systematics->SetTrackSynchronous(false); // Tell systematics that we have asynchronous generations
-  systematics->AddPairwiseDistanceDataNode();
+  if (config.SYSTEMATICS_PAIRWISE_DISTANCE_SAMPLES()) {
+    // Same data node name (and output columns) as AddPairwiseDistanceDataNode, but measured on a fixed number of pairs.
+    distance_sampler = emp::NewPtr<distance_sampler_t>(config.SEED(), config.SYSTEMATICS_PAIRWISE_DISTANCE_SAMPLES());
+    systematics->AddDataNode("pairwise_distance")->AddPullSet(
+      [this]() { return distance_sampler->Sample(*systematics); }
+    );
+  } else {
+    systematics->AddPairwiseDistanceDataNode();
+  }
   systematics->AddPhylogeneticDiversityDataNode();
+  if (config.OUTPUT_PHYLOGENY_FORMAT() == "events") {
+    // Attach now to catch every taxon (the log file is opened in SetupDataCollection).
+    phylogeny_log = emp::NewPtr<phylogeny_log_t>();
+    phylogeny_log->Attach(*systematics);
+  }
   for (auto world_ptr : worlds) {
     world_ptr->SetSharedSystematics(systematics, max_world_size);
   }
@@ -433,11 +620,22 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupSystema
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupDataCollection() {
   output_dir = config.OUTPUT_DIR();
+  if (IsDistributed() && !transport->IsRoot()) {
+    // Non-root ranks write their own world summaries into a subdirectory
+    output_dir += "/rank_" + emp::to_string(transport->GetRank());
+    std::filesystem::create_directories(output_dir);
+  }
   if (setup) {
     // anything we need to do if this function is called post-setup
     if (world_summary_file) world_summary_file.Delete();
+    DeleteWorldSummaryBuffers();
     if (world_evaluation_file) world_evaluation_file.Delete();
     if (world_systematics_file) world_systematics_file.Delete();
+    if (early_stop_file) early_stop_file.Delete();
+    if (coverage_file) coverage_file.Delete();
+    #ifdef DIRDEVO_INSTRUMENTATION
+    if (performance_file) performance_file.Delete();
+    #endif // DIRDEVO_INSTRUMENTATION
   } else {
     mkdir(output_dir.c_str(), ACCESSPERMS);
     if(output_dir.back() != '/') {
@@ -452,82 +650,175 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupDataCol
   // WORLD UPDATE SUMMARY
   if (config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY()) {
     // TODO - rename world_summary file and associated functions?
+    auto add_summary_columns = [&get_epoch](world_aware_data_file_t& file) {
+      // Experiment level functions
+      file.template AddFun<size_t>(get_epoch,"epoch");
+      // World-level functions
+      world_t::AttachWorldUpdateDataFileFunctions(file);
+    };
     world_summary_file = emp::NewPtr<world_aware_data_file_t>(output_dir + "world_summary.csv");
-    // Experiment level functions
-    world_summary_file->template AddFun<size_t>(get_epoch,"epoch");
-    // World-level functions
-    world_t::AttachWorldUpdateDataFileFunctions(*world_summary_file);
+    add_summary_columns(*world_summary_file);
     world_summary_file->PrintHeaderKeys();
+    // Worlds write their rows into their own buffers as they run (on whichever thread runs them); see
+    // WriteWorldSummaries.
+    world_summary_buffers.resize(worlds.size()); // (never resized again; buffer files hold references to these)
+    for (auto& buffer : world_summary_buffers) {
+      world_summary_buffer_files.emplace_back(emp::NewPtr<world_aware_data_file_t>(buffer));
+      add_summary_columns(*world_summary_buffer_files.back());
+    }
+  }
+
+  //////////////////////////////////
+  // EARLY STOPPING
+  if (config.EARLY_STOP_UPDATES()) {
+    early_stop_file = emp::NewPtr<world_aware_data_file_t>(output_dir + "early_stop.csv");
+    early_stop_file->template AddFun<size_t>(get_epoch, "epoch");
+    early_stop_file->template AddFun<size_t>(
+      [this]() { return early_stop_file->GetCurWorld().GetWorldID(); },
+      "world_id"
+    );
+    early_stop_file->template AddFun<size_t>(
+      [this]() { return early_stop_updates[early_stop_file->GetCurWorld().GetWorldID() - first_world_id]; },
+      "stop_update"
+    );
+    early_stop_file->template AddFun<size_t>(
+      [this]() { return config.UPDATES_PER_EPOCH() + 1 - early_stop_updates[early_stop_file->GetCurWorld().GetWorldID() - first_world_id]; },
+      "updates_skipped"
+    );
+    early_stop_file->template AddFun<double>(
+      [this]() { return early_stop_file->GetCurWorld().GetPlateauScore(); },
+      "score"
+    );
+    early_stop_file->PrintHeaderKeys();
   }
 
   //////////////////////////////////
   // WORLD EVALUATION
-  world_evaluation_file = emp::NewPtr<emp::DataFile>(output_dir + "world_evaluation.csv");
-  // Experiment level functions
-  // epoch
-  world_evaluation_file->AddFun<size_t>(get_epoch, "epoch");
+  // Every process has every world's scores, so only the root process needs to record them.
+  if (transport->IsRoot()) {
+    world_evaluation_file = emp::NewPtr<emp::DataFile>(output_dir + "world_evaluation.csv");
+    // Experiment level functions
+    // epoch
+    world_evaluation_file->AddFun<size_t>(get_epoch, "epoch");
+
+    // aggregate scores
+    world_evaluation_file->AddFun<std::string>(
+      [this]() {
+        std::ostringstream stream;
+        stream << "\"[";
+        for (size_t i = 0; i < aggregate_scores.size(); ++i) {
+          if (i) stream << ",";
+          stream << aggregate_scores[i];
+        }
+        stream << "]\"";
+        return stream.str();
+      },
+      "aggregate_scores"
+    );
 
-  // aggregate scores
-  world_evaluation_file->AddFun<std::string>(
-    [this]() {
-      std::ostringstream stream;
-      stream << "\"[";
-      for (size_t i = 0; i < worlds.size(); ++i) {
-        if (i) stream << ",";
-        stream << aggregate_score_funs[i]();
-      }
-      stream << "]\"";
-      return stream.str();
-    },
-    "aggregate_scores"
-  );
+    // scores (by world, by function)
+    world_evaluation_file->AddFun<std::string>(
+      [this]() {
+        std::ostringstream stream;
+        stream << "\"[[";
+        for (size_t i = 0; i < scores.GetNumRows(); ++i) {
+          if (i) stream << ",[";
+          for (size_t fun_i = 0; fun_i < scores.GetNumCols(); ++fun_i) {
+            if (fun_i) stream << ",";
+            stream << scores(i, fun_i);
+          }
+          stream << "]";
+        }
+        stream << "]\"";
+        return stream.str();
+      },
+      "scores"
+    );
 
-  // scores (by world, by function)
-  world_evaluation_file->AddFun<std::string>(
-    [this]() {
-      std::ostringstream stream;
-      stream << "\"[[";
-      for (size_t i = 0; i < worlds.size(); ++i) {
-        emp_assert(i < score_fun_sets.size());
-        if (i) stream << ",[";
-        for (size_t fun_i = 0; fun_i < score_fun_sets[i].size(); ++fun_i) {
-          if (fun_i) stream << ",";
-          stream << score_fun_sets[i][fun_i]();
+    // selected
+    world_evaluation_file->AddFun<std::string>(
+      [this]() {
+        std::ostringstream stream;
+        stream << "\"[";
+        const auto& selected = selector->GetSelected();
+        for (size_t i = 0; i < selected.size(); ++i) {
+          if (i) stream << ",";
+          stream << selected[i];
         }
-        stream << "]";
-      }
-      stream << "]\"";
-      return stream.str();
-    },
-    "scores"
-  );
+        stream << "]\"";
+        return stream.str();
+      },
+      "selected"
+    );
 
-  // selected
-  world_evaluation_file->AddFun<std::string>(
-    [this]() {
-      std::ostringstream stream;
-      stream << "\"[";
-      const auto& selected = selector->GetSelected();
-      for (size_t i = 0; i < selected.size(); ++i) {
-        if (i) stream << ",";
-        stream << selected[i];
-      }
-      stream << "]\"";
-      return stream.str();
-    },
-    "selected"
-  );
+    // unique selected
+    world_evaluation_file->AddFun<size_t>(
+      [this]() {
+        const auto& selected = selector->GetSelected();
+        return std::unordered_set<size_t>(selected.begin(), selected.end()).size();
+      },
+      "num_unique_selected"
+    );
 
-  // unique selected
-  world_evaluation_file->AddFun<size_t>(
-    [this]() {
-      const auto& selected = selector->GetSelected();
-      return std::unordered_set<size_t>(selected.begin(), selected.end()).size();
-    },
-    "num_unique_selected"
-  );
+    world_evaluation_file->PrintHeaderKeys();
+  }
 
-  world_evaluation_file->PrintHeaderKeys();
+  //////////////////////////////////
+  // COVERAGE ANALYSIS
+  // Like world evaluation, computed from the score table, so only the root process needs to do it.
+  if (config.OUTPUT_COVERAGE_ANALYSIS() && transport->IsRoot()) {
+    const size_t num_objectives = scores.GetNumCols();
+    emp_assert(num_objectives <= MAX_COVERAGE_TASKS, "Checked by ValidateConfig.", num_objectives);
+    coverage_file = emp::NewPtr<emp::DataFile>(output_dir + "coverage.csv");
+    coverage_file->AddFun<size_t>(get_epoch, "epoch");
+    coverage_file->AddFun<size_t>([this]() { return config.NUM_POPS(); }, "metapop_size");
+    coverage_file->AddFun<size_t>([this]() { return count_tasks(metapop_coverage); }, "metapop_tasks_covered", "Objectives covered by any world.");
+    coverage_file->AddFun<std::string>(
+      [this, num_objectives]() { return coverage_to_string(metapop_coverage, num_objectives); },
+      "metapop_coverage",
+      "Objectives covered by any world (one character per objective)."
+    );
+    coverage_file->AddFun<size_t>(
+      [this]() { return coverage_solutions[cur_coverage_solution].num_profiles; },
+      "n_pops"
+    );
+    coverage_file->AddFun<double>(
+      [this]() { return (double)coverage_solutions[cur_coverage_solution].num_profiles / (double)config.NUM_POPS(); },
+      "n_pops_prop"
+    );
+    coverage_file->AddFun<size_t>(
+      [this]() { return coverage_solutions[cur_coverage_solution].GetCoverage(); },
+      "max_tasks_covered",
+      "Most objectives covered together by n_pops worlds."
+    );
+    coverage_file->AddFun<double>(
+      [this]() {
+        const size_t metapop_tasks_covered = count_tasks(metapop_coverage);
+        return (metapop_tasks_covered) ? (double)coverage_solutions[cur_coverage_solution].GetCoverage() / (double)metapop_tasks_covered : 0.0;
+      },
+      "max_tasks_covered_prop"
+    );
+    coverage_file->AddFun<std::string>(
+      [this, num_objectives]() { return coverage_to_string(coverage_solutions[cur_coverage_solution].covered, num_objectives); },
+      "max_coverage"
+    );
+    coverage_file->AddFun<std::string>(
+      [this]() {
+        std::ostringstream stream;
+        stream << "\"[";
+        const auto& world_ids = coverage_solutions[cur_coverage_solution].profiles;
+        for (size_t i = 0; i < world_ids.size(); ++i) {
+          if (i) stream << ",";
+          stream << world_ids[i];
+        }
+        stream << "]\"";
+        return stream.str();
+      },
+      "max_coverage_worlds",
+      "Worlds (by id) that give max_coverage."
+    );
+    coverage_file->PrintHeaderKeys();
+  }
 
   //////////////////////////////////
   // Systematics
@@ -546,14 +837,66 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupDataCol
     world_systematics_file->AddCurrent(*systematics->GetDataNode("phylogenetic_diversity"), "genotype_current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
     // write file header
     world_systematics_file->PrintHeaderKeys();
+    // phylogeny event log
+    if (phylogeny_log) phylogeny_log->Open(output_dir + "phylogeny_events.csv");
   }
 
+  #ifdef DIRDEVO_INSTRUMENTATION
+  //////////////////////////////////
+  // PERFORMANCE (one line per epoch; covers worlds run by this process)
+  epoch_world_counters.resize(worlds.size());
+  performance_file = emp::NewPtr<emp::DataFile>(output_dir + "performance.csv");
+  performance_file->AddFun<size_t>(get_epoch, "epoch");
+  for (size_t phase = 0; phase < NUM_PHASES; ++phase) {
+    performance_file->AddFun<double>(
+      [this, phase]() { return phase_timer.GetSeconds(phase); },
+      phase_names[phase] + "_seconds",
+      "Wall time spent in the " + phase_names[phase] + " phase of this epoch."
+    );
+  }
+  performance_file->AddFun<double>([this]() { return phase_timer.GetTotalSeconds(); }, "epoch_seconds");
+  // Totals across worlds
+  auto get_total_counters = [this]() {
+    WorldPerfCounters total;
+    for (const auto& counters : epoch_world_counters) total += counters;
+    return total;
+  };
+  performance_file->AddFun<size_t>([get_total_counters]() { return get_total_counters().org_steps; }, "org_steps");
+  performance_file->AddFun<size_t>([get_total_counters]() { return get_total_counters().births; }, "births");
+  performance_file->AddFun<size_t>([get_total_counters]() { return get_total_counters().deaths; }, "deaths");
+  performance_file->AddFun<size_t>([get_total_counters]() { return get_total_counters().scheduler_draws; }, "scheduler_draws");
+  performance_file->AddFun<double>(
+    [this, get_total_counters]() {
+      const double sim_seconds = phase_timer.GetSeconds(PHASE_SIMULATE);
+      return (sim_seconds > 0) ? (double)get_total_counters().org_steps / sim_seconds : 0.0;
+    },
+    "instructions_per_second",
+    "Organism steps (instructions) per second of simulate phase wall time (across all worlds)."
+  );
+  // Per-world throughput
+  performance_file->AddFun<std::string>(
+    [this]() {
+      std::ostringstream stream;
+      stream << "\"[";
+      for (size_t i = 0; i < epoch_world_counters.size(); ++i) {
+        if (i) stream << ",";
+        stream << epoch_world_counters[i].GetStepsPerSecond();
+      }
+      stream << "]\"";
+      return stream.str();
+    },
+    "world_instructions_per_second",
+    "Organism steps (instructions) per second of each world's simulation time (in world id order)."
+  );
+  performance_file->PrintHeaderKeys();
+  #endif // DIRDEVO_INSTRUMENTATION
+
 }
 
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupEliteSelection() {
   selector = emp::NewPtr<EliteSelect>(
-    aggregate_score_funs,
+    aggregate_scores,
     config.ELITE_SEL_NUM_ELITES()
   );
 
@@ -566,7 +909,7 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupEliteSe
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupTournamentSelection() {
   selector = emp::NewPtr<TournamentSelect>(
-    aggregate_score_funs,
+    aggregate_scores,
     random,
     config.TOURNAMENT_SEL_TOURN_SIZE()
   );
@@ -578,10 +921,11 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupTournam
 }
 
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
-void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupLexicaseSelection() {
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupLexicaseSelection(double epsilon) {
   selector = emp::NewPtr<LexicaseSelect>(
-    score_fun_sets,
-    random
+    scores,
+    random,
+    epsilon
   );
 
   do_selection_fun = [this]() -> emp::vector<size_t>& {
@@ -593,7 +937,7 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupLexicas
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupNonDominatedEliteSelection() {
   selector = emp::NewPtr<NonDominatedEliteSelect>(
-    score_fun_sets,
+    scores,
     random
   );
 
@@ -606,7 +950,7 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupNonDomi
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupNonDominatedTournamentSelection() {
   selector = emp::NewPtr<NonDominatedTournamentSelect>(
-    score_fun_sets,
+    scores,
     random,
     config.TOURNAMENT_SEL_TOURN_SIZE()
   );
@@ -617,6 +961,20 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupNonDomi
   };
 }
 
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupNonDominatedSortingSelection() {
+  selector = emp::NewPtr<NonDominatedSortingSelect>(
+    scores,
+    random,
+    config.TOURNAMENT_SEL_TOURN_SIZE()
+  );
+
+  do_selection_fun = [this]() -> emp::vector<size_t>& {
+    emp::Ptr<NonDominatedSortingSelect> sel = selector.Cast<NonDominatedSortingSelect>();
+    return (*sel)(config.NUM_POPS());
+  };
+}
+
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SetupRandomSelection() {
   selector = emp::NewPtr<RandomSelect>(
@@ -709,6 +1067,121 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SnapshotConf
 
 }
 
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::SeedFromLibrary() {
+  GenomeLibrary library;
+  if (!library.Open(config.ANCESTOR_LIBRARY_FILE())) {
+    std::cout << "Failed to open ancestor library. " << library.GetError() << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // Genomes carry no type information, so make sure they were written by this kind of experiment before decoding them.
+  if (!library.Holds<org_t>(config.EXPERIMENT_SETUP())) {
+    std::cout << "Ancestor library " << config.ANCESTOR_LIBRARY_FILE() << " was written by " << library.GetTag()
+              << " (genome size " << library.GetGenomeSize() << "), not by " << config.EXPERIMENT_SETUP()
+              << " (genome size " << library_genome_size<org_t>::value << ")." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if (!library.GetNumSlices()) {
+    std::cout << "Ancestor library is empty. " << config.ANCESTOR_LIBRARY_FILE() << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  const bool seed_population = config.ANCESTOR_LIBRARY_SEEDING() == "population";
+
+  // Decode each world's genomes (worlds only read from their own slice, so this can happen in parallel).
+  emp::vector<emp::vector<genome_t>> world_genomes(worlds.size());
+  auto load_world = [&](size_t i) {
+    world_t& world = *worlds[i];
+    const size_t slice = world.GetWorldID() % library.GetNumSlices();
+    const size_t num_genomes = library.GetNumGenomes(slice);
+    if (!num_genomes) return;
+    const size_t chosen = (seed_population) ? 0 : world_rngs[i].GetUInt(num_genomes);
+    const size_t num_keep = (seed_population) ? std::min(num_genomes, world.GetSize()) : 1;
+    ByteReader in(library.GetSliceReader(slice));
+    for (size_t genome_i = 0; (genome_i < num_genomes) && (world_genomes[i].size() < num_keep); ++genome_i) {
+      genome_t genome(org_t::ReadGenome(in, world));
+      if (seed_population || genome_i == chosen) world_genomes[i].emplace_back(std::move(genome));
+    }
+  };
+
+  #ifdef DIRDEVO_THREADING
+  const size_t pool_size = std::min(worlds.size(), num_threads);
+  if (pool_size > 1) {
+    std::atomic<size_t> next_world{0};
+    auto load_worlds = [&load_world, &next_world, this]() {
+      for (size_t i = next_world++; i < worlds.size(); i = next_world++) {
+        load_world(i);
+      }
+    };
+    emp::vector<std::thread> threads;
+    for (size_t thread_id = 1; thread_id < pool_size; ++thread_id) {
+      threads.emplace_back(load_worlds);
+    }
+    load_worlds();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  } else
+  #endif // DIRDEVO_THREADING
+  {
+    for (size_t i = 0; i < worlds.size(); ++i) {
+      load_world(i);
+    }
+  }
+
+  // Inject (in order, on this thread: systematics tracking isn't thread-safe)
+  for (size_t i = 0; i < worlds.size(); ++i) {
+    if (world_genomes[i].empty()) {
+      std::cout << "Ancestor library has no genomes for " << worlds[i]->GetName() << "." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    for (size_t pos = 0; pos < world_genomes[i].size(); ++pos) {
+      worlds[i]->InjectAt(world_genomes[i][pos], pos);
+    }
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::WritePopulationLibrary() {
+  // Each process writes the worlds it runs.
+  const std::string path = output_dir + (
+    (IsDistributed()) ? "population_library_rank_" + emp::to_string(transport->GetRank()) + ".ddgl" : "population_library.ddgl"
+  );
+  GenomeLibraryWriter<org_t> writer(path, worlds.size(), config.EXPERIMENT_SETUP());
+  for (auto world_ptr : worlds) {
+    writer.StartSlice();
+    for (size_t pos = 0; pos < world_ptr->GetSize(); ++pos) {
+      if (world_ptr->IsOccupied({pos})) writer.AddGenome(world_ptr->GetOrg(pos).GetGenome());
+    }
+  }
+  if (!writer.Close()) {
+    std::cout << "Failed to write population library. " << path << std::endl;
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::AnalyzeCoverage() {
+  emp_assert(coverage_file);
+  emp_assert(scores.GetNumCols() <= MAX_COVERAGE_TASKS);
+  const double threshold = config.OUTPUT_COVERAGE_THRESHOLD();
+  emp::vector<task_mask_t> world_coverage(scores.GetNumRows(), 0);
+  metapop_coverage = 0;
+  for (size_t world_id = 0; world_id < scores.GetNumRows(); ++world_id) {
+    const double* world_scores = scores.GetRow(world_id);
+    for (size_t obj_i = 0; obj_i < scores.GetNumCols(); ++obj_i) {
+      if (world_scores[obj_i] >= threshold) world_coverage[world_id] |= ((task_mask_t)1 << obj_i);
+    }
+    metapop_coverage |= world_coverage[world_id];
+  }
+  coverage_solutions = solve_max_coverage(world_coverage);
+  for (auto& solution : coverage_solutions) {
+    std::sort(solution.profiles.begin(), solution.profiles.end());
+  }
+  // One row per number of worlds
+  for (cur_coverage_solution = 0; cur_coverage_solution < coverage_solutions.size(); ++cur_coverage_solution) {
+    coverage_file->Update();
+  }
+}
+
 template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
 bool DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::ValidateConfig() {
   // GLOBAL SETTINGS
@@ -719,13 +1192,39 @@ bool DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::ValidateConf
   if (config.LOCAL_GRID_HEIGHT() < 1) return false;
   if (config.LOCAL_GRID_DEPTH() < 1) return false;
   if (config.AVG_STEPS_PER_ORG() < 1) return false;
+  if (config.EARLY_STOP_UPDATES() && !world_t::CanStopEarly()) {
+    std::cout << "Early stopping (EARLY_STOP_UPDATES) is not supported by this experiment's task." << std::endl;
+    return false;
+  }
   if (!emp::Has(valid_selection_methods,config.SELECTION_METHOD())) return false;
+  if (!emp::Has(valid_phylogeny_formats,config.OUTPUT_PHYLOGENY_FORMAT())) return false;
+  if (!emp::Has(valid_ancestor_library_seeding,config.ANCESTOR_LIBRARY_SEEDING())) return false;
   if (config.POPULATION_SAMPLING_SIZE() < 1) return false;
+  // OUTPUT SETTINGS
+  // Objectives come from the worlds' tasks, so these are checked once the worlds exist (Setup validates again then).
+  if (config.OUTPUT_COVERAGE_ANALYSIS() && worlds.size() && worlds[0]->GetNumSubTasks() > MAX_COVERAGE_TASKS) {
+    std::cout << "Coverage analysis supports at most " << MAX_COVERAGE_TASKS << " objectives (this experiment has " << worlds[0]->GetNumSubTasks() << ")." << std::endl;
+    return false;
+  }
+  // DISTRIBUTED SETTINGS
+  if (config.DISTRIBUTED_NUM_PROCS() < 1) return false;
+  if (config.DISTRIBUTED_RANK() >= config.DISTRIBUTED_NUM_PROCS()) return false;
+  if (config.DISTRIBUTED_NUM_PROCS() > config.NUM_POPS()) {
+    std::cout << "Cannot split " << config.NUM_POPS() << " worlds across " << config.DISTRIBUTED_NUM_PROCS() << " processes." << std::endl;
+    return false;
+  }
+  if (config.DISTRIBUTED_NUM_PROCS() > 1) {
+    if (!emp::Has(valid_distributed_transports, config.DISTRIBUTED_TRANSPORT())) return false;
+    if (config.TRACK_SYSTEMATICS()) {
+      std::cout << "Cannot track systematics when worlds are split across multiple processes." << std::endl;
+      return false;
+    }
+  }
   // TODO - flesh this out!
 
   #ifdef DIRDEVO_THREADING
-  if (config.TRACK_SYSTEMATICS()) {
-    std::cout << "Cannot track systematics if compiled with threading enabled." << std::endl;
+  if (config.TRACK_SYSTEMATICS() && config.NUM_THREADS() > 1) {
+    std::cout << "Cannot track systematics when running worlds on multiple threads (NUM_THREADS > 1)." << std::endl;
     return false;
   }
   #endif
@@ -738,13 +1237,16 @@ template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typenam
 void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Run() {
   // Create vector to hold the distribution of population ids selected each epoch
 
+  early_stop_updates.assign(worlds.size(), NO_EARLY_STOP);
+
   #ifdef DIRDEVO_THREADING
-  std::function<void(size_t)> run_world = [this](size_t world_id) {
-    worlds[world_id]->SetEpoch(cur_epoch);
-    for (size_t u = 0; u <= config.UPDATES_PER_EPOCH(); u++) {
-      worlds[world_id]->RunStep();
-      // const bool record_update = config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY() && (!(u % config.OUTPUT_SUMMARY_UPDATE_RESOLUTION()) || (u == config.UPDATES_PER_EPOCH()));
-      worlds[world_id]->Update();
+  // Workers pull worlds off of a shared counter, so a worker whose world goes extinct (or stops early) moves on to the
+  // next one.
+  const size_t pool_size = std::min(worlds.size(), num_threads);
+  std::atomic<size_t> next_world{0};
+  std::function<void()> run_worlds = [this, &next_world]() {
+    for (size_t world_id = next_world++; world_id < worlds.size(); world_id = next_world++) {
+      RunWorldEpoch(*worlds[world_id], config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY());
     }
   };
   #endif // DIRDEVO_THREADING
@@ -755,65 +1257,104 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Run() {
     // Refresh epoch-level bookkeeping
     extinct_worlds.clear();
     live_worlds.clear();
+    // Seeds for this epoch's world streams (computed up front, before worlds are handed out to threads)
+    world_seeds = unique_stream_seeds(stream_key, (uint32_t)config.NUM_POPS(), (uint32_t)cur_epoch, WORLD_STREAM_EPOCH);
 
     // Is this an epoch that we want to record data for?
     // - Either correct interval or final epoch.
     record_epoch = !(cur_epoch % config.OUTPUT_SUMMARY_EPOCH_RESOLUTION()) || (cur_epoch == config.EPOCHS());
-    const bool snapshot_phylogeny = config.TRACK_SYSTEMATICS() && (!(cur_epoch % config.OUTPUT_PHYLOGENY_SNAPSHOT_EPOCH_RESOLUTION()) || (cur_epoch == config.EPOCHS()));
+    const bool snapshot_phylogeny = config.TRACK_SYSTEMATICS() && (config.OUTPUT_PHYLOGENY_FORMAT() == "snapshot") && (!(cur_epoch % config.OUTPUT_PHYLOGENY_SNAPSHOT_EPOCH_RESOLUTION()) || (cur_epoch == config.EPOCHS()));
     const bool record_systematics = config.TRACK_SYSTEMATICS() && (!(cur_epoch % config.OUTPUT_SYSTEMATICS_EPOCH_RESOLUTION()) || (cur_epoch == config.EPOCHS()));
 
-    #ifdef DIRDEVO_THREADING
-    ///////////////////////////////////////////////
-    // THREADING ENABLED
-    emp::vector<std::thread> threads;
-    for (size_t world_id = 1; world_id < worlds.size(); ++world_id) {
-      threads.emplace_back(
-        run_world,
-        world_id
-      );
-    }
-    run_world(0); // use the main thread to run world 0
-    // Join threads
-    for (auto& thread : threads) {
-      thread.join();
-    }
-    // Update world summary file
+    #ifdef DIRDEVO_INSTRUMENTATION
+    phase_timer.Reset();
     for (auto world_ptr : worlds) {
-      world_summary_file->Update(world_ptr);
+      world_ptr->GetPerfCounters().Reset();
     }
-    ///////////////////////////////////////////////
-    #else
-    ///////////////////////////////////////////////
-    // THREADING DISABLED
-    // Run worlds forward X updates.
-    for (auto world_ptr : worlds) {
-      std::cout << "Running world " << world_ptr->GetName() << std::endl;
-      world_ptr->SetEpoch(cur_epoch);
-      for (size_t u = 0; u <= config.UPDATES_PER_EPOCH(); u++) {
-        world_ptr->RunStep();
-        const bool record_update = config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY() && (!(u % config.OUTPUT_SUMMARY_UPDATE_RESOLUTION()) || (u == config.UPDATES_PER_EPOCH()));
-        if (record_update) {
-          world_summary_file->Update(world_ptr);
+    phase_timer.Start(PHASE_SIMULATE);
+    #endif // DIRDEVO_INSTRUMENTATION
+
+    #ifdef DIRDEVO_THREADING
+    if (pool_size > 1) {
+      ///////////////////////////////////////////////
+      // MULTIPLE THREADS
+      next_world = 0;
+      emp::vector<std::thread> threads;
+      for (size_t thread_id = 1; thread_id < pool_size; ++thread_id) {
+        threads.emplace_back(run_worlds);
+      }
+      run_worlds(); // the main thread is a worker too
+      // Join threads
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      ///////////////////////////////////////////////
+    } else
+    #endif // DIRDEVO_THREADING
+    {
+      ///////////////////////////////////////////////
+      // SINGLE THREAD
+      // Run worlds forward X updates.
+      for (auto world_ptr : worlds) {
+        std::cout << "Running world " << world_ptr->GetName() << std::endl;
+        RunWorldEpoch(*world_ptr, config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY());
+      }
+      ///////////////////////////////////////////////
+    }
+
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_OUTPUT);)
+    if (world_summary_file) WriteWorldSummaries();
+
+    // Log worlds that stopped early
+    if (early_stop_file) {
+      for (auto world_ptr : worlds) {
+        if (early_stop_updates[world_ptr->GetWorldID() - first_world_id] != NO_EARLY_STOP) {
+          early_stop_file->Update(world_ptr);
         }
-        world_ptr->Update();
       }
     }
-    ///////////////////////////////////////////////
-    #endif //DIRDEVO_THREADING
 
+    #ifdef DIRDEVO_INSTRUMENTATION
+    // Grab counters before they pick up any deaths caused by clearing out worlds at the end of this epoch.
+    for (size_t i = 0; i < worlds.size(); ++i) {
+      epoch_world_counters[i] = worlds[i]->GetPerfCounters();
+    }
+    phase_timer.Start(PHASE_EVALUATE);
+    #endif // DIRDEVO_INSTRUMENTATION
 
     // Do evaluation (could move this into previous loop if I don't add anything else here that requires all worlds to have been run)
-    for (size_t world_id = 0; world_id < worlds.size(); ++world_id) {
-      worlds[world_id]->Evaluate();
-      (worlds[world_id]->IsExtinct()) ? extinct_worlds.insert(world_id) : live_worlds.insert(world_id);
+    for (auto world_ptr : worlds) {
+      world_ptr->Evaluate();
+      RecordWorldScores(*world_ptr);
     }
+    // Collect scores from worlds run by other processes.
+    ExchangeScores();
+    for (size_t world_id = 0; world_id < config.NUM_POPS(); ++world_id) {
+      (world_extinct[world_id]) ? extinct_worlds.insert(world_id) : live_worlds.insert(world_id);
+    }
+
+    const bool all_worlds_extinct = extinct_worlds.size() == config.NUM_POPS();
 
-    const bool all_worlds_extinct = extinct_worlds.size() == worlds.size();
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_OUTPUT);)
+
+    // Analyze metapopulation coverage?
+    if (record_epoch && coverage_file) {
+      AnalyzeCoverage();
+    }
+
+    // Write out the final populations (before they're cleared out for the next round of propagules)?
+    if (config.OUTPUT_POPULATION_LIBRARY() && (cur_epoch == config.EPOCHS())) {
+      WritePopulationLibrary();
+    }
 
     // Snapshot the phylogeny?
     if (snapshot_phylogeny) {
       systematics->Snapshot(output_dir + "phylogeny_" + emp::to_string(cur_epoch) + ".csv");
     }
+    // Or, mark the end of this epoch in the phylogeny event log (any epoch can be rebuilt as a snapshot from the log).
+    if (phylogeny_log) {
+      phylogeny_log->MarkEpoch(cur_epoch, (cur_epoch+1)*config.UPDATES_PER_EPOCH());
+    }
 
     // Record systematics?
     if (record_systematics) {
@@ -847,30 +1388,58 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Run() {
     ///////////////////////////////////////////////////////////////////////////////////////
 
     // Do selection: `selected` contains ids of selected populations.
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_SELECT);)
     auto& selected = do_selection_fun();
 
     // Record results of evaluation?
-    if (record_epoch) {
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_OUTPUT);)
+    if (record_epoch && world_evaluation_file) {
       world_evaluation_file->Update();
     }
 
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_SAMPLE);)
+
     // For each selected world, extract a sample
-    propagules.resize(config.NUM_POPS(), {});
-    emp_assert(propagules.size()==selected.size());
+    // - If the selected world is run by another process, that process does the sampling.
+    // - If the propagule is destined for a world run by another process, the sampled genomes are sent over.
+    propagules.resize(worlds.size(), {});
+    emp_assert(config.NUM_POPS()==selected.size());
+    std::string outgoing_propagules;
+    ByteWriter outgoing(outgoing_propagules);
+    propagule_t remote_propagule;
     for (size_t i = 0; i < selected.size(); ++i) {
       // Sample propagules from each world!
       size_t selected_pop_id = selected[i];
       // Make sure selected pop is isn't extinct (in some weird edge case)
       // Note that we cannot be here if all populations are extinct. Spin until we pull a non-extinct pop.
       while (emp::Has(extinct_worlds, selected_pop_id)) {
-        selected_pop_id = (selected_pop_id + 1) % worlds.size();
+        selected_pop_id = (selected_pop_id + 1) % config.NUM_POPS();
+      }
+      if (!IsLocalWorld(selected_pop_id)) continue;
+      world_t& source_world = *worlds[selected_pop_id - first_world_id];
+      if (IsLocalWorld(i)) {
+        // Sample from the selected world to form the propagule.
+        Sample(source_world, propagules[i - first_world_id]);
+      } else {
+        // Sample, then pack up the propagule for the process that runs world i.
+        Sample(source_world, remote_propagule);
+        std::string packed_genomes;
+        ByteWriter packed(packed_genomes);
+        for (TransferOrg& transfer_org : remote_propagule) {
+          org_t::WriteGenome(transfer_org.org->GetGenome(), packed);
+          transfer_org.org.Delete();
+        }
+        outgoing.Write<uint64_t>(i);
+        outgoing.Write<uint64_t>(remote_propagule.size());
+        outgoing.WriteString(packed_genomes);
+        remote_propagule.clear();
       }
-      // Sample from the selected world to form the propagule.
-      Sample(*worlds[selected_pop_id], propagules[i]);
     }
+    ExchangePropagules(outgoing_propagules);
 
+    DIRDEVO_INSTRUMENT(phase_timer.Start(PHASE_RESEED);)
     // Reset worlds + inject propagules into them!
-    const size_t propagule_offset = max_world_size*worlds.size(); // Propagules will have positions offset past all valid world positions
+    const size_t propagule_offset = max_world_size*config.NUM_POPS(); // Propagules will have positions offset past all valid world positions
 
     const size_t transfer_time = (cur_epoch+1)*config.UPDATES_PER_EPOCH(); // cur_epoch+1 because this is at the end of an epoch (so after its updates have elapsed)
     if (config.TRACK_SYSTEMATICS()) {
@@ -888,7 +1457,7 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Run() {
       }
     }
 
-    for (size_t i = 0; i < config.NUM_POPS(); ++i) {
+    for (size_t i = 0; i < worlds.size(); ++i) {
       auto& world = *(worlds[i]);
       world.DirectedDevoReset(); // Clear our the world.
       emp_assert(propagules[i].size(), "Propagule is empty.");
@@ -909,6 +1478,141 @@ void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::Run() {
     if (config.TRACK_SYSTEMATICS()) {
       systematics->Update();
     }
+
+    #ifdef DIRDEVO_INSTRUMENTATION
+    phase_timer.Stop();
+    performance_file->Update();
+    #endif // DIRDEVO_INSTRUMENTATION
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::RunWorldEpoch(world_t& world, bool record_updates) {
+  emp_assert(!record_updates || world_summary_file);
+  world.SetEpoch(cur_epoch);
+  // Everything the world draws this epoch (running, sampling propagules, and reseeding) comes from this epoch's stream.
+  world_rngs[world.GetWorldID() - first_world_id].ResetSeed(world_seeds[world.GetWorldID()]);
+  const size_t num_updates = config.UPDATES_PER_EPOCH() + 1;
+  early_stop_updates[world.GetWorldID() - first_world_id] = NO_EARLY_STOP;
+  // Summary rows go to this world's own buffer (see WriteWorldSummaries).
+  emp::Ptr<world_aware_data_file_t> summary_file = (record_updates) ? world_summary_buffer_files[world.GetWorldID() - first_world_id] : nullptr;
+  for (size_t u = 0; u < num_updates; ++u) {
+    const bool extinct = !world.GetNumOrgs();
+    if (extinct || world.HasPlateaued()) {
+      if (!extinct) early_stop_updates[world.GetWorldID() - first_world_id] = u;
+      // Skip ahead, only stopping to write (unchanging) summary rows.
+      size_t next = record_updates ? NextSummaryUpdate(u) : num_updates;
+      world.SkipUpdates(next - u);
+      while (next < num_updates) {
+        summary_file->Update(emp::Ptr<world_t>(&world));
+        const size_t after = NextSummaryUpdate(next + 1);
+        world.SkipUpdates(after - next);
+        next = after;
+      }
+      return;
+    }
+    world.RunStep();
+    if (record_updates && NextSummaryUpdate(u) == u) {
+      summary_file->Update(emp::Ptr<world_t>(&world));
+    }
+    world.Update();
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+size_t DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::NextSummaryUpdate(size_t u) const {
+  const size_t last_update = config.UPDATES_PER_EPOCH();
+  if (u > last_update) return last_update + 1;
+  const size_t resolution = config.OUTPUT_SUMMARY_UPDATE_RESOLUTION();
+  const size_t next = ((u + resolution - 1) / resolution) * resolution; // Round up to the next multiple of resolution
+  return std::min(next, last_update); // The last update of an epoch is always recorded
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::WriteWorldSummaries() {
+  for (auto& buffer : world_summary_buffers) {
+    world_summary_file->WriteRows(buffer.str());
+    buffer.str("");
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::DeleteWorldSummaryBuffers() {
+  for (auto file : world_summary_buffer_files) file.Delete();
+  world_summary_buffer_files.clear();
+  world_summary_buffers.clear();
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::RecordWorldScores(world_t& world) {
+  const size_t world_id = world.GetWorldID();
+  emp_assert(world_id < aggregate_scores.size());
+  emp_assert(world.GetNumSubTasks() == scores.GetNumCols());
+  world.WriteTaskPerformance(aggregate_scores[world_id], scores.GetRow(world_id));
+  world_extinct[world_id] = world.IsExtinct();
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::ExchangeScores() {
+  if (!IsDistributed()) return;
+  // Pack up scores for each of my worlds: world id, extinct, aggregate score, objective scores
+  std::string send;
+  ByteWriter out(send);
+  for (auto world_ptr : worlds) {
+    const size_t world_id = world_ptr->GetWorldID();
+    out.Write<uint64_t>(world_id);
+    out.Write<uint8_t>(world_extinct[world_id]);
+    out.Write<double>(aggregate_scores[world_id]);
+    const double* world_scores = scores.GetRow(world_id);
+    for (size_t fun_i = 0; fun_i < scores.GetNumCols(); ++fun_i) {
+      out.Write<double>(world_scores[fun_i]);
+    }
+  }
+  emp::vector<std::string> recv;
+  transport->AllGather(send, recv);
+  // Unpack everyone else's scores
+  for (size_t rank = 0; rank < recv.size(); ++rank) {
+    if (rank == transport->GetRank()) continue;
+    ByteReader in(recv[rank]);
+    while (!in.AtEnd()) {
+      const size_t world_id = in.Read<uint64_t>();
+      emp_assert(world_id < config.NUM_POPS());
+      world_extinct[world_id] = in.Read<uint8_t>();
+      aggregate_scores[world_id] = in.Read<double>();
+      double* world_scores = scores.GetRow(world_id);
+      for (size_t fun_i = 0; fun_i < scores.GetNumCols(); ++fun_i) {
+        world_scores[fun_i] = in.Read<double>();
+      }
+    }
+  }
+}
+
+template <typename WORLD, typename ORG, typename MUTATOR, typename TASK, typename PERIPHERAL>
+void DirectedDevoExperiment<WORLD, ORG, MUTATOR, TASK, PERIPHERAL>::ExchangePropagules(const std::string& outgoing) {
+  if (!IsDistributed()) return;
+  emp::vector<std::string> recv;
+  transport->AllGather(outgoing, recv);
+  // Every process receives every packed propagule; only unpack the ones destined for my worlds.
+  for (size_t rank = 0; rank < recv.size(); ++rank) {
+    if (rank == transport->GetRank()) continue;
+    ByteReader in(recv[rank]);
+    while (!in.AtEnd()) {
+      const size_t dest_world_id = in.Read<uint64_t>();
+      const size_t num_genomes = in.Read<uint64_t>();
+      const size_t packed_size = in.Read<uint64_t>();
+      if (!IsLocalWorld(dest_world_id)) {
+        in.Skip(packed_size);
+        continue;
+      }
+      // Genomes are decoded by the destination world (decoding may require world-level components, e.g., an instruction set).
+      world_t& dest_world = *worlds[dest_world_id - first_world_id];
+      propagule_t& dest = propagules[dest_world_id - first_world_id];
+      dest.clear();
+      for (size_t gen_i = 0; gen_i < num_genomes; ++gen_i) {
+        dest.emplace_back();
+        dest.back().org = emp::NewPtr<org_t>(org_t::ReadGenome(in, dest_world));
+      }
+    }
   }
 }
 
@@ -3,23 +3,52 @@
 #define DIRECTED_DEVO_DIRECTED_DEVO_WORLD_HPP_INCLUDE
 
 #include <unordered_set>
+#include <unordered_map>
 #include <deque>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
 
-#include "emp/Evolve/World.hpp"
+#include "emp/base/Ptr.hpp"
+#include "emp/Evolve/Systematics.hpp"
 #include "emp/datastructs/IndexMap.hpp"
+#include "emp/datastructs/vector_utils.hpp"
+#include "emp/math/Random.hpp"
+#include "emp/tools/string_utils.hpp"
 
 #include "utility/ProbabilisticScheduler.hpp"
+#include "utility/PopulationStore.hpp"
 #include "DirectedDevoConfig.hpp"
 #include "utility/ConfigSnapshotEntry.hpp"
 #include "utility/WorldAwareDataFile.hpp"
+#include "utility/PerformanceCounters.hpp"
+#include "utility/HookTraits.hpp"
+#include "utility/GenotypeFingerprint.hpp"
 
 namespace dirdevo {
 
+template<typename DERIVED_T> class BaseOrganism;
+template<typename DERIVED_T, typename ORG_T> class BaseTask;
+
+/// Does the mutator report which sites its last Mutate call changed (via GetLastFlips)?
+template<typename MUTATOR_T, typename=void>
+struct mutator_reports_flips : std::false_type { };
+
+template<typename MUTATOR_T>
+struct mutator_reports_flips<
+  MUTATOR_T,
+  std::void_t<decltype(std::declval<const MUTATOR_T&>().GetLastFlips())>
+> : std::true_type { };
+
 // TODO - add world peripheral??? => Can hold instruction sets?
 //        OR, assume that directeddevoworld is not the end point? that is, you need to derive from it
 // TODO - clean up configuration (let the world configure more of itself (move out of the experiment..)!)
+/// A single population of organisms working on a world-level task.
+/// Organisms live in a PopulationStore (not an emp::World): births, deaths, and placements call organism/task hooks
+/// directly (no signals), and only hooks that the organism/task actually implement are called.
 template <typename ORG, typename TASK>
-class DirectedDevoWorld : public emp::World<ORG> {
+class DirectedDevoWorld {
 public:
   friend TASK; // Let the task see my insides. TASK should be sure to be a responsible friend...
 
@@ -47,22 +76,20 @@ public:
   };
 
   // Helpful type aliases
-  using base_t = emp::World<ORG>;
   using this_t = DirectedDevoWorld<ORG, TASK>;
   using task_t = TASK;
   using scheduler_t = ProbabilisticScheduler;
   using pop_struct_t = PopStructureDesc;
   using org_t = ORG;
-  using genome_t = typename base_t::genome_t;
+  using genome_t = typename org_t::genome_t;
+  using pop_t = PopulationStore<org_t>;
+  using mut_fun_t = std::function<size_t(org_t&, emp::Random&)>;
+  using flips_fun_t = std::function<const emp::vector<size_t>&(void)>;
   using config_t = DirectedDevoConfig;
-  using systematics_t = emp::Systematics<org_t, genome_t>; // TODO - work out how to add on extra taxon-associated data tracking if necessary!
+  using systematics_t = emp::Systematics<org_t, genotype_fingerprint_t>; // Taxa are keyed by genome fingerprint. TODO - work out how to add on extra taxon-associated data tracking if necessary!
   using taxon_t = typename systematics_t::taxon_t;
-
-  // Public functions in base type that we want to use w/out this reference
-  using base_t::GetUpdate;
-  using base_t::GetOrg;
-  using base_t::GetSize;
-  using base_t::GetNumOrgs;
+  using org_base_t = BaseOrganism<org_t>;
+  using task_base_t = BaseTask<task_t, org_t>;
 
   static bool IsValidPopStructure(const std::string & mode);
   static POP_STRUCTURE PopStructureStrToMode(const std::string & mode);
@@ -93,16 +120,38 @@ public:
 
 protected:
 
-  using base_t::pop;
-  using base_t::name;
-  using base_t::control;
-  using base_t::on_death_sig;
+  // Which optional organism/task hooks are implemented? Hooks left at their BaseOrganism/BaseTask (no-op) defaults
+  // are compiled out of the world.
+  static constexpr bool ORG_ON_INJECT_READY = overrides_hook_v<decltype(&org_t::OnInjectReady), decltype(&org_base_t::OnInjectReady)>;
+  static constexpr bool ORG_ON_BEFORE_REPRO = overrides_hook_v<decltype(&org_t::OnBeforeRepro), decltype(&org_base_t::OnBeforeRepro)>;
+  static constexpr bool ORG_ON_OFFSPRING_READY = overrides_hook_v<decltype(&org_t::OnOffspringReady), decltype(&org_base_t::OnOffspringReady)>;
+  static constexpr bool ORG_ON_DEATH = overrides_hook_v<decltype(&org_t::OnDeath), decltype(&org_base_t::OnDeath)>;
+  static constexpr bool ORG_ON_MUTATIONS = overrides_hook_v<decltype(&org_t::OnMutations), decltype(&org_base_t::OnMutations)>;
+  static constexpr bool TASK_ON_BEFORE_WORLD_UPDATE = overrides_hook_v<decltype(&task_t::OnBeforeWorldUpdate), decltype(&task_base_t::OnBeforeWorldUpdate)>;
+  static constexpr bool TASK_ON_WORLD_UPDATE = overrides_hook_v<decltype(&task_t::OnWorldUpdate), decltype(&task_base_t::OnWorldUpdate)>;
+  static constexpr bool TASK_GET_RUNNING_SCORE = overrides_hook_v<decltype(&task_t::GetRunningScore), decltype(&task_base_t::GetRunningScore)>;
+  static constexpr bool TASK_ON_ORG_INJECT_READY = overrides_hook_v<decltype(&task_t::OnOrgInjectReady), decltype(&task_base_t::OnOrgInjectReady)>;
+  static constexpr bool TASK_ON_BEFORE_ORG_REPRO = overrides_hook_v<decltype(&task_t::OnBeforeOrgRepro), decltype(&task_base_t::OnBeforeOrgRepro)>;
+  static constexpr bool TASK_ON_OFFSPRING_READY = overrides_hook_v<decltype(&task_t::OnOffspringReady), decltype(&task_base_t::OnOffspringReady)>;
+  static constexpr bool TASK_ON_ORG_PLACEMENT = overrides_hook_v<decltype(&task_t::OnOrgPlacement), decltype(&task_base_t::OnOrgPlacement)>;
+  static constexpr bool TASK_BEFORE_ORG_PROCESS_STEP = overrides_hook_v<decltype(&task_t::BeforeOrgProcessStep), decltype(&task_base_t::BeforeOrgProcessStep)>;
+  static constexpr bool TASK_AFTER_ORG_PROCESS_STEP = overrides_hook_v<decltype(&task_t::AfterOrgProcessStep), decltype(&task_base_t::AfterOrgProcessStep)>;
+  static constexpr bool TASK_ON_ORG_DEATH = overrides_hook_v<decltype(&task_t::OnOrgDeath), decltype(&task_base_t::OnOrgDeath)>;
+  static constexpr bool TASK_AFTER_ORG_SWAP = overrides_hook_v<decltype(&task_t::AfterOrgSwap), decltype(&task_base_t::AfterOrgSwap)>;
+
+  emp::Random& random;                ///< Random number generator (NON-OWNING)
+  std::string name;
+  size_t update=0;                    ///< Current world update
+  pop_t pop;                          ///< The population (one organism per cell)
+  mut_fun_t mut_fun;                  ///< Used to mutate offspring
+  flips_fun_t flips_fun;              ///< Sites changed by the last mut_fun call (passed to the organism's OnMutations)
 
   const config_t& config; ///< Reference to the experiment's configuration.
   size_t max_pop_size=0;              /// Maximum population size (depends on population structure and configuration)
   size_t avg_org_steps_per_update=1;  /// Determines the number of execution steps we dish out each update (population size * this).
   bool extinct=false;                 /// flag for whether of not the population is extinct
   scheduler_t scheduler;              /// Used to schedule organism execution based on their merit.
+  emp::vector<double> merit_buffer;   /// Used internally to bulk-load organism merits into the scheduler
   task_t task;                        /// Used to track task performance
   std::function<double(void)> aggregate_performance_fun;
   pop_struct_t pop_struct;
@@ -110,6 +159,15 @@ protected:
   size_t cur_epoch=0;
   bool track_systematics=false;
 
+  size_t plateau_window=0;            ///< Updates without a score change before the world counts as plateaued (0 = never)
+  bool plateau_tracking=false;        ///< Has a score been recorded since the last reset?
+  double plateau_score=0;             ///< Most recent running score
+  size_t plateau_start=0;             ///< Update at which the running score last changed
+
+  #ifdef DIRDEVO_INSTRUMENTATION
+  WorldPerfCounters perf_counters;    ///< Hot path counters (reset by the experiment each epoch)
+  #endif // DIRDEVO_INSTRUMENTATION
+
   /// Wraps the shared
   // TODO - setup ability to strip out systematics tracking (because it can be a performance hit)
   struct SharedSystematicsWrapper {
@@ -145,16 +203,22 @@ protected:
 
   void SetPopStructure(const pop_struct_t & pop_struct); // TODO - clean this up more!
 
+  /// Place an organism (replacing the organism already at pos, if any).
+  void AddOrgAt(size_t pos, org_t&& org);
+
+  /// Remove the organism at pos (organism/task hear about it first).
+  void RemoveOrgAt(size_t pos);
+
 public:
 
-  // using base_t::base_t;
   DirectedDevoWorld(
     const config_t& cfg,
     emp::Random & rnd,
-    const std::string & name="",
+    const std::string & world_name="",
     size_t id=0
   ) :
-    base_t(rnd, name),
+    random(rnd),
+    name(world_name),
     config(cfg),
     scheduler(rnd),
     task(*this),
@@ -164,113 +228,86 @@ public:
       cfg.LOCAL_GRID_HEIGHT(),
       cfg.LOCAL_GRID_DEPTH()
     ),
-    world_id(id)
+    world_id(id),
+    plateau_window(cfg.EARLY_STOP_UPDATES())
   {
-    /// TODO - document the order of signal calls in the world!
-    /// TODO - is there a way to strip out unused functions?
-
-    // Wire up event handles to world signals.
-    // - Update scheduler weights on organism placement, death, and swap.
-    // - Tell task about placement, death, etc
-    // - Tell organism about placement, death, etc
-
-    // NOTE - reminder that on placement signal will still trigger for injected organisms!
-    this->OnInjectReady(
-      [this](org_t& org) {
-        org.OnInjectReady();
-        task.OnOrgInjectReady(org);
-      }
-    );
-
-    this->OnPlacement(
-      [this](size_t pos) {
-        auto& org = this->GetOrg(pos);
-        if (track_systematics) {
-          shared_systematics_wrapper.AddOrg(org, pos, GetUpdate());
-        }
-        org.OnPlacement(pos);                        // Tell the organism about its placement.
-        task.OnOrgPlacement(org, pos);               // Tell the task about organism placement.
-        scheduler.AdjustWeight(pos, org.GetMerit()); // Update scheduler weights last.
-        extinct=false; // World can't be extinct anymore
-      }
-    );
+    // Configure population structure.
+    SetPopStructure(pop_struct);
+    task.OnWorldSetup(); // Tell the task that the world has been configured.
+    aggregate_performance_fun = task.GetAggregatePerformanceFun(); // TODO - test that this wiring works as expected!
+  }
 
-    auto org_death_key = this->OnOrgDeath(
-      [this](size_t pos) {
-        auto& org = this->GetOrg(pos);
-        org.OnDeath(pos);
-        task.OnOrgDeath(org, pos);
-        scheduler.AdjustWeight(pos, 0); // Update scheduler weights last.
-        if (track_systematics) {
-          shared_systematics_wrapper.RemoveOrgAfterRepro(pos, GetUpdate());
-        }
-      }
-    );
+  // NOTE - when a world is destroyed, its organisms are destroyed without calling organism/task death hooks.
+  DirectedDevoWorld(const this_t&) = delete;
+  this_t& operator=(const this_t&) = delete;
 
-    // We need to remove the on death signal to prevent it from being triggered when the world clears the population (calling remove org)
-    this->OnWorldDestruct(
-      [this,org_death_key]() {
-        on_death_sig.Remove(org_death_key);
-      }
-    );
+  const std::string& GetName() const { return name; }
+  size_t GetWorldID() const { return world_id; }
 
-    this->OnSwapOrgs(
-      [this](emp::WorldPosition p1, emp::WorldPosition p2) {
-        auto& org1 = this->GetOrg(p1.GetIndex());
-        auto& org2 = this->GetOrg(p2.GetIndex());
-        // Organisms have already been swapped, so p1 org needs index to reflect p1; same with p2 org.
-        org1.SetWorldID(p1.GetIndex());
-        org2.SetWorldID(p2.GetIndex());
-
-        task.AfterOrgSwap(org1, org2);
-
-        // Update scheduler weights last
-        const auto& weight_map = scheduler.GetWeightMap();
-        const double p1_weight = weight_map.GetWeight(p1.GetIndex());
-        const double p2_weight = weight_map.GetWeight(p2.GetIndex());
-        scheduler.AdjustWeight(p1.GetIndex(), p2_weight);
-        scheduler.AdjustWeight(p2.GetIndex(), p1_weight);
-      }
-    );
+  size_t GetUpdate() const { return update; }
+  size_t GetSize() const { return pop.GetSize(); }
+  size_t GetNumOrgs() const { return pop.GetNumOrgs(); }
+  bool IsOccupied(size_t pos) const { return pop.IsOccupied(pos); }
+  org_t& GetOrg(size_t pos) { return pop.GetOrg(pos); }
+  const org_t& GetOrg(size_t pos) const { return pop.GetOrg(pos); }
+  emp::Random& GetRandom() { return random; }
+  const pop_t& GetPopulation() const { return pop; }
+
+  /// Get a random occupied position (world must not be empty).
+  size_t GetRandomOrgID() { return pop.GetRandomOrgID(random); }
+
+  /// Advance the world's update counter (the experiment calls this after each RunStep).
+  void Update() { ++update; }
+
+  /// Configure the function used to mutate offspring (returns the number of mutations).
+  /// If the organism implements OnMutations, flips must return the sites changed by the last call to fun.
+  void SetMutFun(const mut_fun_t& fun, const flips_fun_t& flips=nullptr) {
+    emp_assert(!ORG_ON_MUTATIONS || !fun || flips, "Organism implements OnMutations, but no flips function was given.");
+    mut_fun = fun;
+    flips_fun = flips;
+  }
 
-    // Organism about to reproduce. Before building offspring.
-    this->OnBeforeRepro(
-      [this](size_t parent_pos) {
-        auto& parent = this->GetOrg(parent_pos);
-        parent.OnBeforeRepro();     // Tell parent that it's about to reproduce
-        task.OnBeforeOrgRepro(parent); // Tell task about reproduction
-      }
+  /// Mutate offspring with the given mutator (NON-OWNING; must outlive the world).
+  template<typename MUTATOR_T>
+  void SetMutator(MUTATOR_T& mutator) {
+    static_assert(
+      !ORG_ON_MUTATIONS || mutator_reports_flips<MUTATOR_T>::value,
+      "Organism implements OnMutations, so its mutator must report flipped sites (GetLastFlips)."
     );
-
-    // Offspring constructed, but has not been placed.
-    // Last time to safely access parent.
-    this->OnOffspringReady(
-      [this](org_t& offspring, size_t parent_pos) {
-        this->DoMutationsOrg(offspring); // Do mutations on offspring ready, but before parent sees offspring.
-        if (track_systematics) {
-          shared_systematics_wrapper.SetNextParent(parent_pos);
-        }
-        auto& parent = this->GetOrg(parent_pos);
-        parent.SetIsParent(true);
-        offspring.OnBirth(parent);                // Tell offspring about it's birthday!
-        parent.OnOffspringReady(offspring);       // Tell parent that it's offspring is ready
-        task.OnOffspringReady(offspring, parent); // Tell task that this offspring was born from this parent.
-      }
+    flips_fun_t flips;
+    if constexpr (mutator_reports_flips<MUTATOR_T>::value) {
+      flips = [&mutator]() -> const emp::vector<size_t>& { return mutator.GetLastFlips(); };
+    }
+    SetMutFun(
+      [&mutator](org_t& org, emp::Random& rnd) { return mutator.Mutate(org.GetGenome(), rnd); },
+      flips
     );
+  }
 
-    // this->OnUpdate( // Removed this to guarantee it is called before
-    //   [this](size_t u) {
-    //     task.OnWorldUpdate(u);
-    //   }
-    // );
-    // Configure population structure.
-    SetPopStructure(pop_struct);
-    task.OnWorldSetup(); // Tell the task that the world has been configured.
-    aggregate_performance_fun = task.GetAggregatePerformanceFun(); // TODO - test that this wiring works as expected!
+  /// Mutate the given organism (if a mutation function has been configured), then tell it which sites changed.
+  size_t DoMutationsOrg(org_t& org) {
+    if (!mut_fun) return 0;
+    const size_t num_muts = mut_fun(org, random);
+    if constexpr (ORG_ON_MUTATIONS) {
+      if (num_muts) org.OnMutations(flips_fun());
+    }
+    return num_muts;
   }
 
-  const std::string& GetName() const { return name; }
-  size_t GetWorldID() const { return world_id; }
+  /// Build an organism from the given genome and place it at the given position (replacing any organism already
+  /// there). Injected organisms have no parent.
+  void InjectAt(const genome_t& genome, size_t pos);
+
+  /// The organism at parent_pos reproduces: build an offspring from the given genome, mutate it, and place it in a
+  /// random neighboring position (replacing any organism already there, possibly the parent).
+  /// Returns the offspring's position.
+  size_t DoBirth(const genome_t& genome, size_t parent_pos);
+
+  /// Remove the organism at the given position.
+  void DoDeath(size_t pos) { RemoveOrgAt(pos); }
+
+  /// Swap the organisms (or empty cells) at the given positions.
+  void SwapOrgs(size_t pos1, size_t pos2);
 
   SharedSystematicsWrapper& GetSharedSystematics() { return shared_systematics_wrapper; }
 
@@ -293,12 +330,47 @@ public:
     shared_systematics_wrapper.time_offset = epoch * config.UPDATES_PER_EPOCH();
   }
 
+  #ifdef DIRDEVO_INSTRUMENTATION
+  WorldPerfCounters& GetPerfCounters() { return perf_counters; }
+  const WorldPerfCounters& GetPerfCounters() const { return perf_counters; }
+  #endif // DIRDEVO_INSTRUMENTATION
+
   /// Force a re-sync of scheduler weights with organism merits
   void SyncSchedulerWeights();
 
   /// Run world one step (update) forward
   void RunStep();
 
+  /// Advance the world by the given number of updates without running any organisms (for worlds that are extinct or
+  /// that have stopped early). Organisms are frozen in place; the task only hears about the first skipped update.
+  /// For an extinct world, this is equivalent to (but cheaper than) that many rounds of RunStep() and Update().
+  void SkipUpdates(size_t num_updates) {
+    extinct = !GetNumOrgs();
+    if (!num_updates) return;
+    if constexpr (TASK_ON_BEFORE_WORLD_UPDATE) task.OnBeforeWorldUpdate(GetUpdate());
+    // Living (frozen) worlds keep the shared systematics manager's clock ticking, as RunStep would have.
+    if (track_systematics && !extinct) {
+      for (size_t u = 0; u < num_updates; ++u) shared_systematics_wrapper.Update();
+    }
+    update += num_updates;
+  }
+
+  /// Has the world's running score gone unchanged for at least EARLY_STOP_UPDATES updates (since the last reset)?
+  /// Always false if early stopping is disabled or the task does not report a running score.
+  bool HasPlateaued() const {
+    if constexpr (TASK_GET_RUNNING_SCORE) {
+      return plateau_window && plateau_tracking && (update - plateau_start > plateau_window);
+    } else {
+      return false;
+    }
+  }
+
+  /// Can worlds of this type stop early (i.e., does the task report a running score)?
+  static constexpr bool CanStopEarly() { return TASK_GET_RUNNING_SCORE; }
+
+  /// Most recent running score (only meaningful if the task reports a running score and early stopping is enabled).
+  double GetPlateauScore() const { return plateau_score; }
+
   /// Evaluate the world (make sure task performance is current)
   void Evaluate();
 
@@ -316,12 +388,20 @@ public:
     return fun_set.size();
   }
 
+  /// Write this world's aggregate task performance and each sub-task performance (sub_scores must have room for
+  /// GetNumSubTasks() scores). Calls the task directly, so tasks can write scores without going through their
+  /// performance functions.
+  void WriteTaskPerformance(double& aggregate_score, double* sub_scores) {
+    emp_assert(task.IsEvalFresh());
+    task.WriteScores(aggregate_score, sub_scores);
+  }
+
   emp::vector<ConfigSnapshotEntry> GetConfigSnapshotEntries() {
     emp::vector<ConfigSnapshotEntry> entries(task.GetConfigSnapshotEntries()); // Grab all of the task-specific entries
     // Add world entries
     entries.emplace_back(
       "world_size",
-      emp::to_string(this->GetSize()),
+      emp::to_string(GetSize()),
       "world__" + GetName()
     );
     return entries;
@@ -342,23 +422,26 @@ void DirectedDevoWorld<ORG,TASK>::SetPopStructure(
   switch(pop_struct.mode) {
     case POP_STRUCTURE::MIXED: {
       max_pop_size=pop_struct.width*pop_struct.height;
-      this->SetPopStruct_Mixed(false);
-      this->Resize(max_pop_size); // Mixed structure doesn't resize the world, do so here.
+      pop.SetMixed(max_pop_size);
       break;
     }
     case POP_STRUCTURE::GRID: {
       max_pop_size=pop_struct.width*pop_struct.height;
-      this->SetPopStruct_Grid(pop_struct.width, pop_struct.height, false);
+      pop.SetGrid(pop_struct.width, pop_struct.height);
       break;
     }
     case POP_STRUCTURE::GRID3D: {
       max_pop_size=pop_struct.width*pop_struct.height*pop_struct.depth;
-      this->SetPopStruct_3DGrid(pop_struct.width, pop_struct.height, pop_struct.depth, false);
+      pop.SetGrid3D(pop_struct.width, pop_struct.height, pop_struct.depth);
       break;
     }
   }
-  // Setup the scheduler
-  scheduler.Reset(max_pop_size, avg_org_steps_per_update*max_pop_size);
+  // Setup the scheduler (the population is empty, so just zero out weights if the scheduler is already the right size)
+  if (scheduler.GetNumItems() == max_pop_size && scheduler.GetScheduleSize() == avg_org_steps_per_update*max_pop_size) {
+    scheduler.ClearWeights();
+  } else {
+    scheduler.Reset(max_pop_size, avg_org_steps_per_update*max_pop_size);
+  }
 }
 
 template<typename ORG, typename TASK>
@@ -370,64 +453,91 @@ void DirectedDevoWorld<ORG,TASK>::SetAvgOrgStepsPerUpdate(size_t avg_steps) {
 
 template<typename ORG, typename TASK>
 void DirectedDevoWorld<ORG,TASK>::SyncSchedulerWeights() {
-  scheduler.DeferWeightRefresh(); // Bulk adjustments, defer refresh until next index
-  for (size_t i = 0; i < pop.size(); ++i) {
-    if (this->IsOccupied(i)) {
-      const double merit = pop[i]->GetMerit();
-      scheduler.AdjustWeight(i, merit);
-    } else {
-      scheduler.AdjustWeight(i, 0);
+  // Empty cells always have zero weight (organism removal zeroes them), so only occupied cells need a re-sync.
+  const size_t num_orgs = pop.GetNumOrgs();
+  if (4 * num_orgs < pop.GetSize()) {
+    // Sparse population (e.g., freshly seeded with a propagule): adjust occupied cells and only refresh the part
+    // of the scheduler covering them.
+    scheduler.DeferWeightRefresh();
+    for (size_t i = 0; i < num_orgs; ++i) {
+      const size_t pos = pop.GetOccupiedCell(i);
+      scheduler.AdjustWeight(pos, pop.GetOrg(pos).GetMerit());
     }
+  } else {
+    // Dense population: gather merits and rebuild the scheduler in one pass.
+    merit_buffer.assign(pop.GetSize(), 0.0);
+    for (size_t i = 0; i < num_orgs; ++i) {
+      const size_t pos = pop.GetOccupiedCell(i);
+      merit_buffer[pos] = pop.GetOrg(pos).GetMerit();
+    }
+    scheduler.LoadWeights(merit_buffer);
   }
 }
 
 template<typename ORG, typename TASK>
 void DirectedDevoWorld<ORG,TASK>::RunStep() {
   // Tell task that we're about to run an update
-  task.OnBeforeWorldUpdate(GetUpdate());
+  if constexpr (TASK_ON_BEFORE_WORLD_UPDATE) task.OnBeforeWorldUpdate(GetUpdate());
 
   // Check assumptions about the state of the world.
-  const size_t num_orgs = this->GetNumOrgs();
+  const size_t num_orgs = GetNumOrgs();
   extinct = !(bool)num_orgs;
   if (extinct) {
     return;  // If there are no organisms alive, do nothing (world has gone extinct).
   }
-  // emp_assert(scheduler.GetWeightMap().GetWeight() > 0, "Scheduler requires total weight > 0.");
+  // emp_assert(scheduler.GetWeight() > 0, "Scheduler requires total weight > 0.");
 
   /////////////////////////////////////////////////////////////////
-  // std::cout << "-------------- RUN STEP (" << this->GetUpdate() << ") --------------" << std::endl;
+  // std::cout << "-------------- RUN STEP (" << GetUpdate() << ") --------------" << std::endl;
   /////////////////////////////////////////////////////////////////
 
   // --- Beyond this point: assume that the scheduler weights are current and up-to-date ---
+  DIRDEVO_INSTRUMENT(const auto step_start = PhaseTimer::clock_t::now();)
   // Compute how many organism steps we can dish out for this world update!
   const size_t org_step_budget = num_orgs*avg_org_steps_per_update;
   for (size_t step = 0; step < org_step_budget; ++step) {
     // Schedule someone to take a step.
-    emp_assert(scheduler.GetWeightMap().GetWeight() > 0, step, this->GetNumOrgs());
+    emp_assert(scheduler.GetWeight() > 0, step, GetNumOrgs());
     const size_t org_id = scheduler.GetRandom(); // This should reweight the scheduler automatically.
-    auto & org = this->GetOrg(org_id);
+    DIRDEVO_INSTRUMENT(++perf_counters.scheduler_draws;)
+    auto & org = pop.GetOrg(org_id);
     // Step organism forward
-    task.BeforeOrgProcessStep(org);
+    if constexpr (TASK_BEFORE_ORG_PROCESS_STEP) task.BeforeOrgProcessStep(org);
     org.ProcessStep(*this);
-    task.AfterOrgProcessStep(org);
+    if constexpr (TASK_AFTER_ORG_PROCESS_STEP) task.AfterOrgProcessStep(org);
+    DIRDEVO_INSTRUMENT(++perf_counters.org_steps;)
     // Should organism reproduce?
     if (org.GetReproReady()) {
-      auto offspring_pos = this->DoBirth(org.GetGenome(), org_id, 1);
+      const size_t offspring_pos = DoBirth(org.GetGenome(), org_id);
+      DIRDEVO_INSTRUMENT(++perf_counters.births;)
       // If this organism's offspring stomped all over it, we should jump over to the next iteration of the loop
-      if (offspring_pos.GetIndex() == org_id) continue;
+      if (offspring_pos == org_id) continue;
     }
     // should this organism die?
     if (org.GetDead()) {
-      this->DoDeath({org_id});
+      DoDeath(org_id);
       // if everything is dead, break out of this loop
-      if (!this->GetNumOrgs()) break;
+      if (!GetNumOrgs()) break;
     }
   }
 
+  DIRDEVO_INSTRUMENT(perf_counters.simulate_seconds += std::chrono::duration<double>(PhaseTimer::clock_t::now() - step_start).count();)
+
   // TODO - any data recording, etc here
 
   // Update the world
-  task.OnWorldUpdate(GetUpdate()); // Guarantee that this is called before externally-attached on update functions
+  if constexpr (TASK_ON_WORLD_UPDATE) task.OnWorldUpdate(GetUpdate()); // Guarantee that this is called before externally-attached on update functions
+  if constexpr (TASK_GET_RUNNING_SCORE) {
+    // Track how long the world's score has been stuck (for early stopping).
+    if (plateau_window) {
+      const double score = task.GetRunningScore();
+      if (!plateau_tracking || score != plateau_score) {
+        plateau_tracking = true;
+        plateau_score = score;
+        plateau_start = GetUpdate();
+      }
+    }
+  }
   if (track_systematics) shared_systematics_wrapper.Update();
   // this->Update(); // <- MANAGED BY THE EXPERIMENT
 }
@@ -440,10 +550,93 @@ void DirectedDevoWorld<ORG,TASK>::Evaluate() {
 template<typename ORG, typename TASK>
 void DirectedDevoWorld<ORG,TASK>::DirectedDevoReset() {
   task.OnWorldReset();          // Tell task that the world is being reset.
-  base_t::Reset();              // Call base reset function.
+  // Remove everyone (organism/task/scheduler/systematics all hear about each death).
+  while (pop.GetNumOrgs()) {
+    RemoveOrgAt(pop.GetOccupiedCell(pop.GetNumOrgs() - 1));
+  }
+  update = 0;
+  plateau_tracking = false;
   SetPopStructure(pop_struct);  // Reset the population structure.
 }
 
+template<typename ORG, typename TASK>
+void DirectedDevoWorld<ORG,TASK>::AddOrgAt(size_t pos, org_t&& new_org) {
+  if (pop.IsOccupied(pos)) RemoveOrgAt(pos);
+  auto& org = pop.Place(pos, std::move(new_org));
+  if (track_systematics) {
+    shared_systematics_wrapper.AddOrg(org, pos, GetUpdate());
+  }
+  org.OnPlacement(pos);                        // Tell the organism about its placement.
+  if constexpr (TASK_ON_ORG_PLACEMENT) {
+    task.OnOrgPlacement(org, pos);             // Tell the task about organism placement.
+  }
+  scheduler.AdjustWeight(pos, org.GetMerit()); // Update scheduler weights last.
+  extinct=false; // World can't be extinct anymore
+}
+
+template<typename ORG, typename TASK>
+void DirectedDevoWorld<ORG,TASK>::RemoveOrgAt(size_t pos) {
+  DIRDEVO_INSTRUMENT(++perf_counters.deaths;)
+  if constexpr (ORG_ON_DEATH || TASK_ON_ORG_DEATH) {
+    auto& org = pop.GetOrg(pos);
+    if constexpr (ORG_ON_DEATH) org.OnDeath(pos);
+    if constexpr (TASK_ON_ORG_DEATH) task.OnOrgDeath(org, pos);
+  }
+  scheduler.AdjustWeight(pos, 0); // Update scheduler weights last.
+  if (track_systematics) {
+    shared_systematics_wrapper.RemoveOrgAfterRepro(pos, GetUpdate());
+  }
+  pop.Remove(pos);
+}
+
+template<typename ORG, typename TASK>
+void DirectedDevoWorld<ORG,TASK>::InjectAt(const genome_t& genome, size_t pos) {
+  emp_assert(pos < GetSize(), pos, GetSize());
+  org_t new_org(genome);
+  if constexpr (ORG_ON_INJECT_READY) new_org.OnInjectReady();
+  if constexpr (TASK_ON_ORG_INJECT_READY) task.OnOrgInjectReady(new_org);
+  AddOrgAt(pos, std::move(new_org));
+}
+
+template<typename ORG, typename TASK>
+size_t DirectedDevoWorld<ORG,TASK>::DoBirth(const genome_t& genome, size_t parent_pos) {
+  auto& parent = pop.GetOrg(parent_pos);
+  // Organism about to reproduce. Before building offspring.
+  if constexpr (ORG_ON_BEFORE_REPRO) parent.OnBeforeRepro();        // Tell parent that it's about to reproduce
+  if constexpr (TASK_ON_BEFORE_ORG_REPRO) task.OnBeforeOrgRepro(parent); // Tell task about reproduction
+  // Offspring constructed, but has not been placed.
+  // Last time to safely access parent.
+  org_t offspring(genome);
+  DoMutationsOrg(offspring); // Do mutations on offspring ready, but before parent sees offspring.
+  if (track_systematics) {
+    shared_systematics_wrapper.SetNextParent(parent_pos);
+  }
+  parent.SetIsParent(true);
+  offspring.OnBirth(parent);                // Tell offspring about it's birthday!
+  if constexpr (ORG_ON_OFFSPRING_READY) {
+    parent.OnOffspringReady(offspring);     // Tell parent that it's offspring is ready
+  }
+  if constexpr (TASK_ON_OFFSPRING_READY) {
+    task.OnOffspringReady(offspring, parent); // Tell task that this offspring was born from this parent.
+  }
+  // Place offspring (possibly on top of its parent).
+  const size_t offspring_pos = pop.GetRandomNeighbor(parent_pos, random);
+  AddOrgAt(offspring_pos, std::move(offspring));
+  return offspring_pos;
+}
+
+template<typename ORG, typename TASK>
+void DirectedDevoWorld<ORG,TASK>::SwapOrgs(size_t pos1, size_t pos2) {
+  pop.Swap(pos1, pos2);
+  // Organisms have already been swapped, so pos1 org needs index to reflect pos1; same with pos2 org.
+  if (pop.IsOccupied(pos1)) pop.GetOrg(pos1).SetWorldID(pos1);
+  if (pop.IsOccupied(pos2)) pop.GetOrg(pos2).SetWorldID(pos2);
+  if constexpr (TASK_AFTER_ORG_SWAP) {
+    if (pop.IsOccupied(pos1) && pop.IsOccupied(pos2)) task.AfterOrgSwap(pop.GetOrg(pos1), pop.GetOrg(pos2));
+  }
+  scheduler.SwapWeights(pos1, pos2); // Update scheduler weights last
+}
+
 template<typename ORG, typename TASK>
 bool DirectedDevoWorld<ORG,TASK>::IsValidPopStructure(const std::string & mode) {
   return emp::Has({"mixed", "grid", "grid3d"}, mode);
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include <utility>
 #include <functional>
 #include <filesystem>
 #include <sys/stat.h>
@@ -37,6 +38,7 @@
 #include "AvidaGPEnvironmentBank.hpp"
 
 #include "../../utility/pareto.hpp"
+#include "../../utility/ScoreMatrix.hpp"
 
 namespace dirdevo {
 
@@ -59,7 +61,7 @@ EMP_BUILD_CONFIG(AvidaGPEvoCompConfig,
   VALUE(EVAL_STEPS, size_t, 30, "How many CPU cycles do programs get per evaluation?"),
 
   GROUP(SELECTION_SETTINGS, "Settings for selecting individuals as parents"),
-  VALUE(SELECTION_METHOD, std::string, "elite", "Which algorithm should be used to select populations to propagate? Options: elite, tournament"),
+  VALUE(SELECTION_METHOD, std::string, "elite", "Which algorithm should be used to select populations to propagate? Options: elite, tournament, lexicase, non-dominated-elite, non-dominated-sorting, random, none"),
   VALUE(ELITE_SEL_NUM_ELITES, size_t, 1, "(elite selection) The top ELITE_SEL_NUM_ELITES populations are propagated"),
   VALUE(TOURNAMENT_SEL_TOURN_SIZE, size_t, 4, "(tournament selection) How large are tournaments?"),
 
@@ -94,26 +96,25 @@ void EliteSelect(emp::World<ORG> & world, size_t e_count=1, size_t repro_count=1
   emp_assert(e_count > 0 && e_count <= world.GetNumOrgs(), e_count);
   emp_assert(repro_count > 0);
 
-  // Load the population into a multimap, sorted by fitness.
-  std::multimap<double, size_t> fit_map;
+  // Score the population.
+  emp::vector<std::pair<double, size_t>> fit_ids;
+  fit_ids.reserve(world.GetNumOrgs());
   for (size_t id = 0; id < world.GetSize(); id++) {
     if (world.IsOccupied(id)) {
-      const double cur_fit = world.CalcFitnessID(id);
-      fit_map.insert( std::make_pair(cur_fit, id) );
+      fit_ids.emplace_back(world.CalcFitnessID(id), id);
     }
   }
 
-  emp::vector<size_t> elites(e_count, 0);
-  // Grab the organisms with the top fitnesses.
-  auto m = fit_map.rbegin();
-  for (size_t i = 0; i < e_count; i++) {
-    const size_t repro_id = m->second;
-    elites[i] = repro_id;
-    ++m;
-  }
+  // Grab the organisms with the top fitnesses (ties go to the larger position).
+  std::partial_sort(
+    fit_ids.begin(),
+    fit_ids.begin() + e_count,
+    fit_ids.end(),
+    [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) { return a > b; }
+  );
   // Reproduce elites up to repro_count.
   for (size_t i = 0; i < repro_count; ++i) {
-    const size_t selected_id = elites[i%e_count];
+    const size_t selected_id = fit_ids[i%e_count].second;
     world.DoBirth(world.GetGenomeAt(selected_id), selected_id);
   }
 
@@ -134,18 +135,17 @@ void NonDominatedEliteSelect(
   const size_t obj_count = fit_funs.size();
 
   // Build a score table.
-  emp::vector< emp::vector<double> > score_table(num_candidates, emp::vector<double>(fit_funs.size(), -1.0));
+  ScoreMatrix score_table(num_candidates, obj_count, -1.0);
   for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
-    score_table[cand_i].resize(obj_count);
     if (!world.IsOccupied(cand_i)) continue;
+    double* row = score_table.GetRow(cand_i);
     for (size_t fun_i = 0; fun_i < obj_count; ++fun_i) {
-      emp_assert(obj_count == fit_funs.size());
-      score_table[cand_i][fun_i] = fit_funs[fun_i](world.GetOrg(cand_i));
+      row[fun_i] = fit_funs[fun_i](world.GetOrg(cand_i));
     }
   }
 
   // Find the pareto front
-  emp::vector<size_t> front(find_pareto_front(score_table));
+  emp::vector<size_t> front(find_pareto_front_fast(score_table));
   // std::cout << "----" << std::endl;
   // std::cout << "Pareto front size: " << front.size() << std::endl;
   // for (size_t i = 0; i < front.size(); ++i) {
@@ -160,6 +160,54 @@ void NonDominatedEliteSelect(
 
 }
 
+template<typename ORG>
+void NonDominatedSortingSelect(
+  emp::World<ORG>& world,
+  const emp::vector< std::function<double(const ORG &)> > & fit_funs,
+  size_t tournament_size,
+  size_t repro_count=1
+) {
+  emp_assert(world.GetSize() > 0);
+  emp_assert(fit_funs.size() > 0);
+  emp_assert(tournament_size > 0);
+
+  const size_t num_candidates = world.GetSize();
+  const size_t obj_count = fit_funs.size();
+
+  // Build a score table.
+  ScoreMatrix score_table(num_candidates, obj_count, -1.0);
+  for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
+    if (!world.IsOccupied(cand_i)) continue;
+    double* row = score_table.GetRow(cand_i);
+    for (size_t fun_i = 0; fun_i < obj_count; ++fun_i) {
+      row[fun_i] = fit_funs[fun_i](world.GetOrg(cand_i));
+    }
+  }
+
+  // Sort everything into fronts, compute crowding distances.
+  emp::vector< emp::vector<size_t> > fronts;
+  emp::vector<size_t> ranks;
+  non_dominated_sort(score_table, fronts, ranks);
+  emp::vector<double> crowding(num_candidates, 0.0);
+  for (const auto& front : fronts) {
+    crowding_distances(score_table, front, crowding);
+  }
+
+  // Crowded tournaments (lower front wins; ties broken by larger crowding distance)
+  auto& random = world.GetRandom();
+  for (size_t i = 0; i < repro_count; ++i) {
+    size_t winner_id = random.GetUInt(num_candidates);
+    for (size_t entry_i = 1; entry_i < tournament_size; ++entry_i) {
+      const size_t entry_id = random.GetUInt(num_candidates);
+      if (ranks[entry_id] < ranks[winner_id] || (ranks[entry_id] == ranks[winner_id] && crowding[entry_id] > crowding[winner_id])) {
+        winner_id = entry_id;
+      }
+    }
+    world.DoBirth(world.GetGenomeAt(winner_id), winner_id);
+  }
+
+}
+
 
 /// Note that this class is not necessarily optimized (in a run time sense) for an evolutionary computing setup.
 /// Instead, I am trying to reuse as many components from the AvidaGP directed evolution experiment as possible because:
@@ -253,6 +301,7 @@ protected:
   void SetupLexicaseSelection();
   void SetupNonDominatedEliteSelection();
   void SetupNonDominatedTournamentSelection();
+  void SetupNonDominatedSortingSelection();
   void SetupRandomSelection();
   void SetupNoSelection();
 
@@ -291,7 +340,7 @@ public:
 };
 
 
-void AvidaGPEvoCompWorld::Setup() {
+inline void AvidaGPEvoCompWorld::Setup() {
   std::cout << "--- Setting up AvidaGP EvoComp World ---" << std::endl;
 
   Reset(); // Reset the world
@@ -391,7 +440,7 @@ void AvidaGPEvoCompWorld::Setup() {
 }
 
 /// Only called when running in threading mode.
-void AvidaGPEvoCompWorld::SetupThreading() {
+inline void AvidaGPEvoCompWorld::SetupThreading() {
 
   #ifdef DIRDEVO_THREADING
   std::cout << "Compiled with threading enabled." << std::endl;
@@ -424,7 +473,7 @@ void AvidaGPEvoCompWorld::SetupThreading() {
 }
 
 /// Analogous to `SetupTasks` in AvidaGPMultiPathwayTask.hpp
-void AvidaGPEvoCompWorld::SetupTasks() {
+inline void AvidaGPEvoCompWorld::SetupTasks() {
   // === Parse environment file ===
   // Check to see if the environment file exists
   const bool env_file_exists = std::filesystem::exists(config.AVIDAGP_ENV_FILE());
@@ -534,7 +583,7 @@ void AvidaGPEvoCompWorld::SetupTasks() {
   #endif // end EMP_NDEBUG
 }
 
-void AvidaGPEvoCompWorld::SetupSelection() {
+inline void AvidaGPEvoCompWorld::SetupSelection() {
 
   // Configure world's fitness function (based on aggregate scores)
   SetFitFun(
@@ -567,6 +616,8 @@ void AvidaGPEvoCompWorld::SetupSelection() {
     SetupNonDominatedEliteSelection();
   } else if (config.SELECTION_METHOD() == "non-dominated-tournament") {
     SetupNonDominatedTournamentSelection();
+  } else if (config.SELECTION_METHOD() == "non-dominated-sorting") {
+    SetupNonDominatedSortingSelection();
   } else if (config.SELECTION_METHOD() == "random") {
     SetupRandomSelection();
   } else if (config.SELECTION_METHOD() == "none") {
@@ -578,7 +629,7 @@ void AvidaGPEvoCompWorld::SetupSelection() {
 
 }
 
-void AvidaGPEvoCompWorld::SetupEliteSelection() {
+inline void AvidaGPEvoCompWorld::SetupEliteSelection() {
   do_selection_sig.AddAction(
     [this]() {
       dirdevo::EliteSelect(*this, config.ELITE_SEL_NUM_ELITES(), config.POP_SIZE());
@@ -586,7 +637,7 @@ void AvidaGPEvoCompWorld::SetupEliteSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupTournamentSelection() {
+inline void AvidaGPEvoCompWorld::SetupTournamentSelection() {
   do_selection_sig.AddAction(
     [this]() {
       emp::TournamentSelect(*this, config.TOURNAMENT_SEL_TOURN_SIZE(), config.POP_SIZE());
@@ -594,7 +645,7 @@ void AvidaGPEvoCompWorld::SetupTournamentSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupLexicaseSelection() {
+inline void AvidaGPEvoCompWorld::SetupLexicaseSelection() {
   do_selection_sig.AddAction(
     [this]() {
       emp::LexicaseSelect(*this, fit_fun_set, config.POP_SIZE());
@@ -602,7 +653,7 @@ void AvidaGPEvoCompWorld::SetupLexicaseSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupNonDominatedEliteSelection() {
+inline void AvidaGPEvoCompWorld::SetupNonDominatedEliteSelection() {
   do_selection_sig.AddAction(
     [this]() {
       NonDominatedEliteSelect(*this, fit_fun_set, config.POP_SIZE());
@@ -610,12 +661,20 @@ void AvidaGPEvoCompWorld::SetupNonDominatedEliteSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupNonDominatedTournamentSelection() {
+inline void AvidaGPEvoCompWorld::SetupNonDominatedTournamentSelection() {
   // todo
   emp_assert(false, "NDT not implemented!");
 }
 
-void AvidaGPEvoCompWorld::SetupRandomSelection() {
+inline void AvidaGPEvoCompWorld::SetupNonDominatedSortingSelection() {
+  do_selection_sig.AddAction(
+    [this]() {
+      NonDominatedSortingSelect(*this, fit_fun_set, config.TOURNAMENT_SEL_TOURN_SIZE(), config.POP_SIZE());
+    }
+  );
+}
+
+inline void AvidaGPEvoCompWorld::SetupRandomSelection() {
   do_selection_sig.AddAction(
     [this]() {
       emp::RandomSelect(*this, config.POP_SIZE());
@@ -623,7 +682,7 @@ void AvidaGPEvoCompWorld::SetupRandomSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupNoSelection() {
+inline void AvidaGPEvoCompWorld::SetupNoSelection() {
   do_selection_sig.AddAction(
     [this]() {
       NoSelect(*this);
@@ -631,7 +690,7 @@ void AvidaGPEvoCompWorld::SetupNoSelection() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupInstLib() {
+inline void AvidaGPEvoCompWorld::SetupInstLib() {
   ///////////////////////////////////////////////////////////////////////////////////
   // Add default instructions
   // - Default instructions not used: Input (replaced), Output (replaced)
@@ -725,7 +784,7 @@ void AvidaGPEvoCompWorld::SetupInstLib() {
 
 }
 
-void AvidaGPEvoCompWorld::SetupMutator() {
+inline void AvidaGPEvoCompWorld::SetupMutator() {
   mutator_t::Configure(mutator, config);
   SetMutFun(
     [this](org_t& org, emp::Random& rnd) {
@@ -735,7 +794,7 @@ void AvidaGPEvoCompWorld::SetupMutator() {
   );
 }
 
-void AvidaGPEvoCompWorld::SetupDataCollection() {
+inline void AvidaGPEvoCompWorld::SetupDataCollection() {
   // create output directory if it doesn't exist yet
   output_dir = config.OUTPUT_DIR();
   mkdir(output_dir.c_str(), ACCESSPERMS);
@@ -862,7 +921,7 @@ void AvidaGPEvoCompWorld::SetupDataCollection() {
 
 }
 
-void AvidaGPEvoCompWorld::InitPop() {
+inline void AvidaGPEvoCompWorld::InitPop() {
   if (config.LOAD_ANCESTOR_FROM_FILE()) {
     hardware_t hw(inst_lib); // Use this dummy hardware because of they wonky way AvidaGP is implemented.
     hw.Load(config.ANCESTOR_FILE());
@@ -874,7 +933,7 @@ void AvidaGPEvoCompWorld::InitPop() {
   }
 }
 
-void AvidaGPEvoCompWorld::DoEvaluation() {
+inline void AvidaGPEvoCompWorld::DoEvaluation() {
 
   #ifdef DIRDEVO_THREADING
   // Thread evaluation!
@@ -955,11 +1014,11 @@ void AvidaGPEvoCompWorld::DoEvaluation() {
   }
 }
 
-void AvidaGPEvoCompWorld::DoSelection() {
+inline void AvidaGPEvoCompWorld::DoSelection() {
   do_selection_sig.Trigger();
 }
 
-void AvidaGPEvoCompWorld::DoUpdate() {
+inline void AvidaGPEvoCompWorld::DoUpdate() {
   const double max_score = CalcFitnessID(max_fit_org_id);
   const size_t cur_update = GetUpdate();
 
@@ -981,7 +1040,7 @@ void AvidaGPEvoCompWorld::DoUpdate() {
   ClearCache();
 }
 
-void AvidaGPEvoCompWorld::DoConfigSnapshot() {
+inline void AvidaGPEvoCompWorld::DoConfigSnapshot() {
   emp::DataFile snapshot_file(output_dir + "/run_config.csv");
   std::function<std::string(void)> get_param;
   std::function<std::string(void)> get_value;
@@ -1072,7 +1131,7 @@ void AvidaGPEvoCompWorld::DoConfigSnapshot() {
 
 }
 
-void AvidaGPEvoCompWorld::DoPopSnapshot() {
+inline void AvidaGPEvoCompWorld::DoPopSnapshot() {
   for (size_t org_id = 0; org_id < GetSize(); ++org_id) {
     emp_assert(IsOccupied(org_id));
     population_snapshotter.cur_org_id = org_id;
@@ -1080,7 +1139,7 @@ void AvidaGPEvoCompWorld::DoPopSnapshot() {
   }
 }
 
-void AvidaGPEvoCompWorld::RunOrg(size_t org_id) {
+inline void AvidaGPEvoCompWorld::RunOrg(size_t org_id) {
   emp_assert(IsOccupied(org_id));
   // Phenotype should be reset from inject/offspring ready signal
   auto& org = GetOrg(org_id);
@@ -1090,13 +1149,13 @@ void AvidaGPEvoCompWorld::RunOrg(size_t org_id) {
   }
 }
 
-void AvidaGPEvoCompWorld::RunStep() {
+inline void AvidaGPEvoCompWorld::RunStep() {
   DoEvaluation();
   DoSelection();
   DoUpdate();
 }
 
-void AvidaGPEvoCompWorld::Run() {
+inline void AvidaGPEvoCompWorld::Run() {
   for (size_t u = 0; u <= config.GENS(); ++u) {
     RunStep();
     if (config.STOP_ON_SOLUTION() & found_solution) break;
@@ -23,7 +23,7 @@
 namespace dirdevo {
 
 /// TODO - move events into proper place once things are more settled (task vs organism vs world)
-class AvidaGPMultiPathwayTask : public BaseTask<AvidaGPMultiPathwayTask, AvidaGPOrganism> {
+class AvidaGPMultiPathwayTask final : public BaseTask<AvidaGPMultiPathwayTask, AvidaGPOrganism> {
 
 public:
 
@@ -185,7 +185,7 @@ public:
 
   // --- WORLD-LEVEL EVENT HOOKS ---
 
-  emp::vector<ConfigSnapshotEntry> GetConfigSnapshotEntries() override {
+  emp::vector<ConfigSnapshotEntry> GetConfigSnapshotEntries() {
     emp::vector<ConfigSnapshotEntry> entries;
     const std::string source("world__" + world.GetName() + "__task");
     std::ostringstream stream;
@@ -269,7 +269,7 @@ public:
   }
 
   /// OnWorldSetup called at end of constructor/world setup
-  void OnWorldSetup() override {
+  void OnWorldSetup() {
     // Configure individual and world logic tasks.
     SetupTasks();
     // Configure merit calculation
@@ -283,15 +283,12 @@ public:
   }
 
   /// OnBeforeWorldUpdate is called at the beginning of running the world update
-  void OnBeforeWorldUpdate(size_t update) override {
+  void OnBeforeWorldUpdate(size_t update) {
     // as soon as the world has updated, evaluation is no longer guaranteed to be fresh
     fresh_eval=false;
   }
 
-  /// OnWorldUpdate is called when the OnUpdate signal is triggered (at the end of a world update)
-  void OnWorldUpdate(size_t update) override { /*todo*/ }
-
-  void OnWorldReset() override {
+  void OnWorldReset() {
     // Reset task performance counts
     std::fill(
       task_performance.begin(),
@@ -309,7 +306,7 @@ public:
   }
 
   /// Evaluate the world on this task.
-  void Evaluate() override {
+  void Evaluate() {
 
     #ifndef EMP_NDEBUG
     // Verbose print statements in debug mode.
@@ -338,20 +335,34 @@ public:
     fresh_eval=true; // mark task evaluation
   }
 
+  /// World's aggregate score as of right now (what Evaluate would compute), without updating the evaluation.
+  /// Task performance counters only move when organisms complete tasks, so this plateaus once the population stops
+  /// completing new world-level tasks.
+  double GetRunningScore() const {
+    double score = 0.0;
+    for (size_t global_task_id : world_task_ids) {
+      score += task_performance[global_task_id] * task_info[global_task_id].world_value;
+    }
+    return score;
+  }
+
+  /// Write task performance directly (bypasses the performance function set).
+  void WriteScores(double& aggregate_score, double* sub_scores) {
+    aggregate_score = world_agg_score;
+    std::copy(world_scores.begin(), world_scores.end(), sub_scores);
+  }
+
   // --- ORGANISM-LEVEL EVENT HOOKS ---
   // These are always called AFTER the organism's equivalent functions.
-  void OnOrgInjectReady(org_t& org) override {
+  void OnOrgInjectReady(org_t& org) {
     // Anything that happens OnOffspringReady might also need to happen here (injected organisms are never offspring)
     emp_assert(total_tasks == task_info.size());
     org.GetPhenotype().Reset(total_tasks);
     org.SetMerit(1.0); // Injected organisms have merit set to 1
   }
 
-  /// Called when parent is about to reproduce, but before an offspring has been constructed.
-  void OnBeforeOrgRepro(org_t & parent) override { /*todo*/ }
-
   /// Called when the offspring has been constructed but has not been placed yet.
-  void OnOffspringReady(org_t& offspring, org_t& parent) override {
+  void OnOffspringReady(org_t& offspring, org_t& parent) {
     // Calculate merit based on parent's phenotype.
     const double merit = calc_merit_fun(parent);
     emp_assert(merit > 0, merit, parent.GetMerit());
@@ -382,7 +393,7 @@ public:
   }
 
   /// Called when org is being placed (@ position) in the world
-  void OnOrgPlacement(org_t& org, size_t position) override {
+  void OnOrgPlacement(org_t& org, size_t position) {
     const size_t num_pathways = task_pathways.size();
     org.SetNumPathways(num_pathways); // Configure organism's number of metabolic pathways
     // Assign organism an environment ID for each pathway
@@ -402,11 +413,8 @@ public:
     }
   }
 
-  /// Called just before the organism's process step function is called.
-  void BeforeOrgProcessStep(org_t& org) override { /*todo*/ }
-
   /// Called just after the organism's process step function is called.
-  void AfterOrgProcessStep(org_t& org) override {
+  void AfterOrgProcessStep(org_t& org) {
     // Analyze organism output buffer for each metabolic pathway
     const size_t num_pathways = task_pathways.size();
     for (size_t pathway_id = 0; pathway_id < num_pathways; ++pathway_id) {
@@ -438,16 +446,9 @@ public:
     const size_t age_limit = org.GetGenome().GetSize()*world.config.AVIDAGP_ORG_AGE_LIMIT();
     org.SetDead(org.GetAge() >= age_limit);
   }
-
-  /// Called before organism is removed from the world.
-  void OnOrgDeath(org_t& org, size_t position) override { /*todo*/ }
-
-  /// Called after two organisms are swapped in the world (new world positions are accurate).
-  void AfterOrgSwap(org_t& org1, org_t& org2) override { /*todo*/ }
-
 };
 
-void AvidaGPMultiPathwayTask::SetupInstLib() {
+inline void AvidaGPMultiPathwayTask::SetupInstLib() {
 
   ///////////////////////////////////////////////////////////////////////////////////
   // Add default instructions
@@ -566,7 +567,7 @@ void AvidaGPMultiPathwayTask::SetupInstLib() {
   }
 }
 
-void AvidaGPMultiPathwayTask::SetupTasks() {
+inline void AvidaGPMultiPathwayTask::SetupTasks() {
 
   // === Parse environment file ===
   // Check to see if environment file exists.
@@ -739,7 +740,7 @@ void AvidaGPMultiPathwayTask::SetupTasks() {
 
 }
 
-void AvidaGPMultiPathwayTask::SetupMeritCalcFun() {
+inline void AvidaGPMultiPathwayTask::SetupMeritCalcFun() {
   // TODO - this is where we would implement options for different merit calculations
   calc_merit_fun = [this](const org_t& org) {
     double merit = 1.0; // Base merit = 1.0
@@ -763,7 +764,7 @@ void AvidaGPMultiPathwayTask::SetupMeritCalcFun() {
   };
 }
 
-void AvidaGPMultiPathwayTask::SetupWorldTaskPerformanceFun() {
+inline void AvidaGPMultiPathwayTask::SetupWorldTaskPerformanceFun() {
 
   aggregate_performance_fun = [this]() {
     return world_agg_score;
@@ -6,6 +6,7 @@
 #include "emp/hardware/AvidaGP.hpp"
 
 #include "AvidaGPReplicator.hpp"
+#include "../../utility/ByteBuffer.hpp"
 
 // STATUS: In progress
 
@@ -14,7 +15,7 @@
 
 namespace dirdevo {
 
-class AvidaGPOrganism : public BaseOrganism<AvidaGPOrganism> {
+class AvidaGPOrganism final : public BaseOrganism<AvidaGPOrganism> {
 
 public:
   struct Genome;
@@ -46,10 +47,11 @@ public:
 
   };
 
-  /// Generates a 100-length genome capable of self-replication.
+  /// Generates a 100-length genome capable of self-replication (using the world's instruction set). Doesn't need an
+  /// experiment (e.g., for benchmarks).
   // TODO - is the organism the best place for this? Maybe the task should be generating the ancestral genome given that it manages everything?
-  template<typename EXPERIMENT_T, typename WORLD_T>
-  static genome_t GenerateAncestralGenome(const EXPERIMENT_T& exp, const WORLD_T& world) {
+  template<typename WORLD_T>
+  static genome_t GenerateAncestralGenome(const WORLD_T& world) {
     hardware_t hw(world.GetTask().GetInstLib()); // need this dummy hardware because of the wonky way AvidaGP is implemented
     // TODO - load common ancestor from file!
     hw.PushInst("Scope", 0);
@@ -65,11 +67,53 @@ public:
     return hw.GetGenome();
   }
 
+  template<typename EXPERIMENT_T, typename WORLD_T>
+  static genome_t GenerateAncestralGenome(const EXPERIMENT_T& exp, const WORLD_T& world) {
+    return GenerateAncestralGenome(world);
+  }
+
+  /// Loads an ancestral genome from the world's ANCESTOR_FILE. Doesn't need an experiment (e.g., for benchmarks).
+  template<typename WORLD_T>
+  static genome_t LoadAncestralGenome(const WORLD_T& world) {
+    hardware_t hw(world.GetTask().GetInstLib()); // need this dummy hardware because of the wonky way AvidaGP is implemented
+    hw.Load(world.GetConfig().ANCESTOR_FILE());
+    return hw.GetGenome();
+  }
+
   /// Loads an ancestral genome from file.
   template<typename EXPERIMENT_T, typename WORLD_T>
   static genome_t LoadAncestralGenome(const EXPERIMENT_T& exp, const WORLD_T& world) {
+    return LoadAncestralGenome(world);
+  }
+
+  /// Write genome to a byte buffer (e.g., to send it to another process).
+  /// Format: genome length (uint32), then for each instruction: id (uint16) followed by its arguments (uint8 each).
+  static void WriteGenome(const genome_t& genome, ByteWriter& out) {
+    out.Write<uint32_t>((uint32_t)genome.GetSize());
+    for (size_t i = 0; i < genome.GetSize(); ++i) {
+      const auto& inst = genome[i];
+      emp_assert(inst.id < 65536);
+      out.Write<uint16_t>((uint16_t)inst.id);
+      emp_assert(inst.args.size() == 3);
+      for (const auto& arg : inst.args) {
+        emp_assert(arg < 256);
+        out.Write<uint8_t>((uint8_t)arg);
+      }
+    }
+  }
+
+  /// Read a genome written by WriteGenome.
+  template<typename WORLD_T>
+  static genome_t ReadGenome(ByteReader& in, const WORLD_T& world) {
     hardware_t hw(world.GetTask().GetInstLib()); // need this dummy hardware because of the wonky way AvidaGP is implemented
-    hw.Load(world.GetConfig().ANCESTOR_FILE());
+    const size_t len = in.Read<uint32_t>();
+    for (size_t i = 0; i < len; ++i) {
+      const size_t id = in.Read<uint16_t>();
+      const size_t arg0 = in.Read<uint8_t>();
+      const size_t arg1 = in.Read<uint8_t>();
+      const size_t arg2 = in.Read<uint8_t>();
+      hw.PushInst(id, arg0, arg1, arg2);
+    }
     return hw.GetGenome();
   }
 
@@ -115,7 +159,7 @@ public:
     hardware.SetNumPathways(n_pathways);
   }
 
-  void OnInjectReady() override {
+  void OnInjectReady() {
     hardware.ResetReplicatorHardware();
     dead=false;
     repro_ready=false;
@@ -125,9 +169,7 @@ public:
     is_parent=false;
   }
 
-  void OnBeforeRepro() override { }
-
-  void OnOffspringReady(this_t& offspring) override {
+  void OnOffspringReady(this_t& offspring) {
     // Reset this (the parent) organism's hardware + reproduction status
     hardware.ResetReplicatorHardware();
     repro_ready=false;
@@ -135,12 +177,12 @@ public:
     cpu_cycles_since_division=0;
   }
 
-  void OnPlacement(size_t position) override {
+  void OnPlacement(size_t position) {
     // let hardware know where it exists in the world
     hardware.SetWorldID(position);
   }
 
-  void OnBirth(this_t& parent) override {
+  void OnBirth(this_t& parent) {
     // note, this happens before parent's OnOffspringReady is called
     hardware.ResetReplicatorHardware(); // Reset AvidaGP virtual hardware
     dead=false;
@@ -156,8 +198,6 @@ public:
     generation=parent.GetGeneration();
   }
 
-  void OnDeath(size_t position) override { /*TODO*/ }
-
   template<typename WORLD_T>
   void ProcessStep(WORLD_T& world) {
     // TODO - fill out process step
@@ -58,7 +58,7 @@ public:
 };
 
 /// Valid tasks for the avidagp task set
-const std::map<std::string,AvidaGPTaskSet::AGP_TaskSpec> AvidaGPTaskSet::valid_tasks={
+inline const std::map<std::string,AvidaGPTaskSet::AGP_TaskSpec> AvidaGPTaskSet::valid_tasks={
   //============================== BOOLEAN LOGIC TASKS ==============================
   {
     "ECHO",
@@ -2,12 +2,16 @@
 #ifndef DIRECTED_DEVO_DIRECTED_DEVO_ONEMAX_ORGANISM_HPP_INCLUDE
 #define DIRECTED_DEVO_DIRECTED_DEVO_ONEMAX_ORGANISM_HPP_INCLUDE
 
+#include "emp/bits/BitSet.hpp"
+#include "emp/math/math.hpp"
+
 #include "../../BaseOrganism.hpp"
+#include "../../utility/ByteBuffer.hpp"
 
 namespace dirdevo {
 
 template<size_t BITS=128>
-class OneMaxOrganism : public BaseOrganism<OneMaxOrganism<BITS>> {
+class OneMaxOrganism final : public BaseOrganism<OneMaxOrganism<BITS>> {
 public:
   struct Phenotype;
   static constexpr size_t GENOME_SIZE=BITS;
@@ -19,22 +23,52 @@ public:
   using base_t::SetReproReady;
   using base_t::SetDead;
 
-  const double REPRO_RES_THRESHOLD=1024;
-  const size_t MAX_AGE=2048;
+  static constexpr double REPRO_RES_THRESHOLD=1024;
+  static constexpr size_t MAX_AGE=2048;
 
   struct Phenotype {
     size_t num_ones=0;
   };
 
+  /// Ancestral genome for the given world (all zeros). Doesn't need an experiment (e.g., for benchmarks).
+  template<typename WORLD_T>
+  static genome_t GenerateAncestralGenome(const WORLD_T& world) {
+    return genome_t(false);
+  }
+
   template<typename EXPERIMENT_T, typename WORLD_T>
   static genome_t GenerateAncestralGenome(const EXPERIMENT_T& exp, const WORLD_T& world) {
-    return genome_t(false);
+    return this_t::GenerateAncestralGenome(world);
   }
 
   template<typename EXPERIMENT_T, typename WORLD_T>
   static genome_t LoadAncestralGenome(const EXPERIMENT_T& exp, const WORLD_T& world) {
     emp_assert(false, "OneMaxOrganism does not support the loading ancestral genomes from file");
-    return this_t::GenerateAncestralGenome(exp, world);
+    return this_t::GenerateAncestralGenome(world);
+  }
+
+  /// Write genome to a byte buffer (e.g., to send it to another process). Bits are packed 8 per byte.
+  static void WriteGenome(const genome_t& genome, ByteWriter& out) {
+    for (size_t i = 0; i < GENOME_SIZE; i += 8) {
+      uint8_t byte = 0;
+      for (size_t b = 0; (b < 8) && (i + b < GENOME_SIZE); ++b) {
+        byte |= (uint8_t)((uint8_t)genome.Get(i + b) << b);
+      }
+      out.Write<uint8_t>(byte);
+    }
+  }
+
+  /// Read a genome written by WriteGenome.
+  template<typename WORLD_T>
+  static genome_t ReadGenome(ByteReader& in, const WORLD_T& world) {
+    genome_t genome(false);
+    for (size_t i = 0; i < GENOME_SIZE; i += 8) {
+      const uint8_t byte = in.Read<uint8_t>();
+      for (size_t b = 0; (b < 8) && (i + b < GENOME_SIZE); ++b) {
+        genome.Set(i + b, (byte >> b) & 1);
+      }
+    }
+    return genome;
   }
 
 protected:
@@ -66,31 +100,38 @@ public:
   phenotype_t & GetPhenotype() { return phenotype; }
   const phenotype_t & GetPhenotype() const { return phenotype; }
 
-  // TODO - figure out way to automatically strip out unimplemented organism function calls from world/experiment
-  void OnInjectReady() override { }
-
-  void OnBeforeRepro() override { }
-
-  void OnOffspringReady(this_t & offspring) override {
+  void OnOffspringReady(this_t & offspring) {
     // Reset this organism after dividing.
     resources = 0;
     repro_count += 1;
   }
 
+  /// Called just after *this* organism's genome was mutated (with the sites that were flipped).
+  /// Keeps num_ones up to date without recounting the whole genome.
+  void OnMutations(const emp::vector<size_t>& flipped_sites) {
+    for (size_t site : flipped_sites) {
+      if (genome.Get(site)) {
+        ++phenotype.num_ones;
+      } else {
+        --phenotype.num_ones;
+      }
+    }
+    emp_assert(phenotype.num_ones == genome.CountOnes());
+  }
+
   // Called when *this* organism is born
   // - when offspringready signal is triggered
   // - after mutations
-  void OnBirth(this_t & parent) override {
-    phenotype.num_ones = genome.CountOnes();
+  // NOTE - num_ones was counted when this organism was constructed (from its parent's genome) and is kept up to
+  //        date by OnMutations.
+  void OnBirth(this_t & parent) {
     this->SetDead(false);
     this->SetReproReady(false);
     this->SetNewBorn(true);
   }
 
-  void OnDeath(size_t) override { }
-
   /// Called when *this* organism is placed
-  void OnPlacement(size_t pos) override {
+  void OnPlacement(size_t pos) {
     this->SetWorldID(pos);
     UpdateMerit();
   }
@@ -2,7 +2,10 @@
 #ifndef DIRECTED_DEVO_DIRECTED_DEVO_ONE_MAX_TASK_HPP_INCLUDE
 #define DIRECTED_DEVO_DIRECTED_DEVO_ONE_MAX_TASK_HPP_INCLUDE
 
+#include <algorithm>
+
 #include "../../BaseTask.hpp"
+#include "../../utility/BitColumnCounter.hpp"
 
 namespace dirdevo {
 
@@ -13,7 +16,7 @@ namespace dirdevo {
  * Multiple criteria = average genome value for each site (works because fixed length genomes)
  */
 template<typename ORG_T>
-class OneMaxTask : public BaseTask<OneMaxTask<ORG_T>, ORG_T> {
+class OneMaxTask final : public BaseTask<OneMaxTask<ORG_T>, ORG_T> {
 
 public:
 
@@ -30,16 +33,22 @@ protected:
   using base_t::world;
 
   emp::vector<double> ones_per_position;
+  BitColumnCounter column_counter;  ///< Used to count ones at each genome site across the population
   double total_num_ones=0;
   size_t num_orgs;
 
 public:
   OneMaxTask(world_t& w) : base_t(w), ones_per_position(org_t::GENOME_SIZE, 0) { ; }
 
+  /// Attaches data file functions to summary file. (OneMax has no task-specific world update summary columns.)
+  static void AttachWorldUpdateDataFileFunctions(
+    WorldAwareDataFile<world_t>& summary_file
+  ) { ; }
+
   // --- WORLD-LEVEL EVENT HOOKS ---
 
   /// OnWorldSetup called at end of constructor/world setup
-  void OnWorldSetup() override {
+  void OnWorldSetup() {
     // TODO - configure task based on world's configuration
 
     // Wire up the aggregate task performance function
@@ -60,15 +69,12 @@ public:
   }
 
   /// OnBeforeWorldUpdate is called at the beginning of running the world update
-  void OnBeforeWorldUpdate(size_t update) override {
+  void OnBeforeWorldUpdate(size_t update) {
     // as soon as the world has updated, evaluation is no longer guaranteed to be fresh
     fresh_eval=false;
   }
 
-  /// OnWorldUpdate is called when the OnUpdate signal is triggered (at the end of a world update)
-  void OnWorldUpdate(size_t update) override { /*todo*/ }
-
-  void OnWorldReset() override {
+  void OnWorldReset() {
     total_num_ones = 0.0;
     std::fill(
       ones_per_position.begin(),
@@ -80,57 +86,33 @@ public:
   // TODO - any selection based hooks!
 
   /// Evaluate the world on this task (count ones).
-  void Evaluate() override {
+  void Evaluate() {
 
     // Reset internal performance state
     total_num_ones = 0.0;
-    std::fill(
-      ones_per_position.begin(),
-      ones_per_position.end(),
-      0.0
-    );
+    column_counter.Reset(org_t::GENOME_SIZE);
 
-    // Count ones!
+    // Count ones! (a whole genome word at a time, see BitColumnCounter)
     num_orgs = world.GetNumOrgs();
     for (size_t org_id = 0; org_id < world.GetSize(); ++org_id) {
       if (!world.IsOccupied({org_id})) continue;
-      auto& org = world.GetOrg(org_id);
-      for (size_t site_i=0; site_i < org.GetGenome().GetSize(); ++site_i) {
-        ones_per_position[site_i] += (double)org.GetGenome().Get(site_i);
-      }
+      const auto& org = world.GetOrg(org_id);
+      const auto& genome = org.GetGenome();
+      column_counter.Add([&genome](size_t word) { return genome.GetUInt64(word); });
       total_num_ones += org.GetPhenotype().num_ones;
     }
+    const auto& counts = column_counter.GetCounts();
+    std::copy(counts.begin(), counts.end(), ones_per_position.begin());
     total_num_ones = (num_orgs) ? total_num_ones / num_orgs : 0;
     fresh_eval=true; // mark task evaluation
 
   }
 
-  // --- ORGANISM-LEVEL EVENT HOOKS ---
-  // These are always called AFTER the organism's equivalent functions.
-
-  void OnOrgInjectReady(org_t& org) override { }
-
-  /// Called when parent is about to reproduce, but before an offspring has been constructed.
-  void OnBeforeOrgRepro(org_t & parent) override { /*todo*/ }
-
-  /// Called when the offspring has been constructed but has not been placed yet.
-  void OnOffspringReady(org_t& offspring, org_t& parent) override { /*todo*/ }
-
-  /// Called when org is being placed (@ position) in the world
-  void OnOrgPlacement(org_t& org, size_t position) override { /*todo*/ }
-
-  /// Called just before the organism's process step function is called.
-  void BeforeOrgProcessStep(org_t& org) override { /*todo*/ }
-
-  /// Called just after the organism's process step function is called.
-  void AfterOrgProcessStep(org_t& org) override { /*todo*/ }
-
-  /// Called before organism is removed from the world.
-  void OnOrgDeath(org_t& org, size_t position) override { /*todo*/ }
-
-  /// Called after two organisms are swapped in the world (new world positions are accurate).
-  void AfterOrgSwap(org_t& org1, org_t& org2) override { /*todo*/ }
-
+  /// Write task performance directly (bypasses the performance function set).
+  void WriteScores(double& aggregate_score, double* sub_scores) {
+    aggregate_score = total_num_ones;
+    std::copy(ones_per_position.begin(), ones_per_position.end(), sub_scores);
+  }
 
 };
 
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef DIRECTED_DEVO_DISTRIBUTED_BASE_TRANSPORT_HPP_INCLUDE
+#define DIRECTED_DEVO_DISTRIBUTED_BASE_TRANSPORT_HPP_INCLUDE
+
+#include <string>
+
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+/// Interface for moving data between the processes (ranks) cooperating on a single experiment.
+/// The experiment only ever needs collective communication at epoch boundaries (scores at selection
+/// time, propagule genomes at transfer time), so that is all a transport needs to provide.
+class BaseTransport {
+public:
+  using buffer_t = std::string;
+
+  virtual ~BaseTransport() = default;
+
+  /// Which rank is this process?
+  virtual size_t GetRank() const = 0;
+
+  /// How many ranks are cooperating?
+  virtual size_t GetNumRanks() const = 0;
+
+  /// Every rank contributes one buffer; every rank receives all contributed buffers (indexed by rank).
+  /// Blocks until all ranks have contributed.
+  virtual void AllGather(const buffer_t& send, emp::vector<buffer_t>& recv) = 0;
+
+  /// Block until every rank reaches this point.
+  virtual void Barrier() {
+    emp::vector<buffer_t> recv;
+    AllGather(buffer_t(), recv);
+  }
+
+  bool IsRoot() const { return GetRank() == 0; }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_DISTRIBUTED_BASE_TRANSPORT_HPP_INCLUDE
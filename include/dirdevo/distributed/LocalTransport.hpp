@@ -0,0 +1,23 @@
+#pragma once
+#ifndef DIRECTED_DEVO_DISTRIBUTED_LOCAL_TRANSPORT_HPP_INCLUDE
+#define DIRECTED_DEVO_DISTRIBUTED_LOCAL_TRANSPORT_HPP_INCLUDE
+
+#include "BaseTransport.hpp"
+
+namespace dirdevo {
+
+/// Transport for a single-process experiment (there is nobody to talk to).
+class LocalTransport : public BaseTransport {
+public:
+  size_t GetRank() const override { return 0; }
+  size_t GetNumRanks() const override { return 1; }
+
+  void AllGather(const buffer_t& send, emp::vector<buffer_t>& recv) override {
+    recv.resize(1);
+    recv[0] = send;
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_DISTRIBUTED_LOCAL_TRANSPORT_HPP_INCLUDE
@@ -0,0 +1,196 @@
+#pragma once
+#ifndef DIRECTED_DEVO_DISTRIBUTED_UNIX_SOCKET_TRANSPORT_HPP_INCLUDE
+#define DIRECTED_DEVO_DISTRIBUTED_UNIX_SOCKET_TRANSPORT_HPP_INCLUDE
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+#include "BaseTransport.hpp"
+
+namespace dirdevo {
+
+/// Hub-and-spoke transport over Unix domain (stream) sockets. Intended for running several
+/// cooperating processes on a single machine.
+/// - Rank 0 listens on the socket path; every other rank connects to it.
+/// - AllGather: each rank sends its buffer to rank 0, rank 0 sends every buffer back to every rank.
+/// Messages are framed as a 64-bit length followed by the payload.
+class UnixSocketTransport : public BaseTransport {
+protected:
+  std::string socket_path;
+  size_t rank=0;
+  size_t num_ranks=1;
+  int listen_fd=-1;
+  emp::vector<int> peer_fds;  ///< Rank 0: one connection per rank (index 0 unused). Other ranks: only index 0 (connection to rank 0).
+
+  [[noreturn]] static void Fail(const std::string& msg) {
+    std::cout << "UnixSocketTransport: " << msg << " (" << std::strerror(errno) << ")" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  static void SendAll(int fd, const char* data, size_t len) {
+    while (len) {
+      const ssize_t sent = ::send(fd, data, len, MSG_NOSIGNAL);
+      if (sent < 0) {
+        if (errno == EINTR) continue;
+        Fail("send failed");
+      }
+      data += sent;
+      len -= (size_t)sent;
+    }
+  }
+
+  static void RecvAll(int fd, char* data, size_t len) {
+    while (len) {
+      const ssize_t got = ::recv(fd, data, len, 0);
+      if (got < 0) {
+        if (errno == EINTR) continue;
+        Fail("recv failed");
+      }
+      if (got == 0) Fail("peer closed connection");
+      data += got;
+      len -= (size_t)got;
+    }
+  }
+
+  static void SendFrame(int fd, const buffer_t& buffer) {
+    const uint64_t len = buffer.size();
+    SendAll(fd, reinterpret_cast<const char*>(&len), sizeof(len));
+    SendAll(fd, buffer.data(), buffer.size());
+  }
+
+  static void RecvFrame(int fd, buffer_t& buffer) {
+    uint64_t len = 0;
+    RecvAll(fd, reinterpret_cast<char*>(&len), sizeof(len));
+    buffer.resize(len);
+    RecvAll(fd, buffer.data(), len);
+  }
+
+  sockaddr_un MakeAddress() const {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+      errno = ENAMETOOLONG;
+      Fail("socket path too long: " + socket_path);
+    }
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+  }
+
+  void SetupRoot(size_t timeout_sec) {
+    sockaddr_un addr = MakeAddress();
+    listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) Fail("could not create socket");
+    ::unlink(socket_path.c_str()); // Clean up after any previous (crashed) run.
+    if (::bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0) Fail("could not bind " + socket_path);
+    if (::listen(listen_fd, (int)num_ranks) < 0) Fail("could not listen on " + socket_path);
+    // Wait for every other rank to connect (in any order) and identify itself.
+    timeval tv{(time_t)timeout_sec, 0};
+    setsockopt(listen_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    for (size_t connected = 1; connected < num_ranks; ++connected) {
+      const int fd = ::accept(listen_fd, nullptr, nullptr);
+      if (fd < 0) Fail("timed out waiting for ranks to connect");
+      uint64_t peer_rank = 0;
+      RecvAll(fd, reinterpret_cast<char*>(&peer_rank), sizeof(peer_rank));
+      if (peer_rank == 0 || peer_rank >= num_ranks || peer_fds[peer_rank] != -1) {
+        Fail("unexpected rank (" + std::to_string(peer_rank) + ") connected");
+      }
+      peer_fds[peer_rank] = fd;
+    }
+  }
+
+  void SetupPeer(size_t timeout_sec) {
+    sockaddr_un addr = MakeAddress();
+    // Rank 0 might not be listening yet; keep trying until the timeout expires.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_sec);
+    while (true) {
+      const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      if (fd < 0) Fail("could not create socket");
+      if (::connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0) {
+        peer_fds[0] = fd;
+        break;
+      }
+      ::close(fd);
+      if (std::chrono::steady_clock::now() > deadline) Fail("could not connect to " + socket_path);
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    const uint64_t my_rank = rank;
+    SendAll(peer_fds[0], reinterpret_cast<const char*>(&my_rank), sizeof(my_rank));
+  }
+
+public:
+
+  UnixSocketTransport(
+    const std::string& path,
+    size_t in_rank,
+    size_t in_num_ranks,
+    size_t timeout_sec=60
+  ) :
+    socket_path(path),
+    rank(in_rank),
+    num_ranks(in_num_ranks),
+    peer_fds(in_num_ranks, -1)
+  {
+    emp_assert(num_ranks > 0);
+    emp_assert(rank < num_ranks, rank, num_ranks);
+    if (num_ranks == 1) return;
+    if (rank == 0) {
+      SetupRoot(timeout_sec);
+    } else {
+      SetupPeer(timeout_sec);
+    }
+  }
+
+  ~UnixSocketTransport() {
+    for (int fd : peer_fds) {
+      if (fd >= 0) ::close(fd);
+    }
+    if (listen_fd >= 0) {
+      ::close(listen_fd);
+      ::unlink(socket_path.c_str());
+    }
+  }
+
+  size_t GetRank() const override { return rank; }
+  size_t GetNumRanks() const override { return num_ranks; }
+
+  void AllGather(const buffer_t& send, emp::vector<buffer_t>& recv) override {
+    recv.resize(num_ranks);
+    if (rank == 0) {
+      recv[0] = send;
+      // Gather...
+      for (size_t r = 1; r < num_ranks; ++r) {
+        RecvFrame(peer_fds[r], recv[r]);
+      }
+      // ...then broadcast.
+      for (size_t r = 1; r < num_ranks; ++r) {
+        for (size_t src = 0; src < num_ranks; ++src) {
+          SendFrame(peer_fds[r], recv[src]);
+        }
+      }
+    } else {
+      SendFrame(peer_fds[0], send);
+      for (size_t src = 0; src < num_ranks; ++src) {
+        RecvFrame(peer_fds[0], recv[src]);
+      }
+    }
+  }
+
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_DISTRIBUTED_UNIX_SOCKET_TRANSPORT_HPP_INCLUDE
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <numeric>
 
+#include "emp/base/vector.hpp"
 #include "emp/bits/BitSet.hpp"
 #include "emp/config/config.hpp"
 #include "emp/math/Random.hpp"
@@ -40,6 +41,7 @@ protected:
 
   mut_config_t config;
   std::string config_prepend;
+  emp::vector<size_t> last_flips; ///< Sites flipped by the most recent call to Mutate
 
 public:
   BitSetMutator()
@@ -49,16 +51,19 @@ public:
   // TODO - enable more sophisticated mutation tracking
   template<size_t LEN>
   size_t Mutate(emp::BitSet<LEN>& bits, emp::Random& random) {
-    size_t flips = 0;
+    last_flips.clear();
     for (size_t i = 0; i < LEN; ++i) {
       if (random.P(config.PER_SITE_SUBSTITUTION_RATE)) {
         bits.Toggle(i);
-        ++flips;
+        last_flips.emplace_back(i);
       }
     }
-    return flips;
+    return last_flips.size();
   }
 
+  /// Sites (in ascending order) flipped by the most recent call to Mutate.
+  const emp::vector<size_t>& GetLastFlips() const { return last_flips; }
+
 };
 
 } // namespace dirdevo
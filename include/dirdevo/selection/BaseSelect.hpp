@@ -4,6 +4,9 @@
 
 namespace dirdevo {
 
+/// Base class for selection schemes. Selection schemes read candidate scores straight from score buffers (e.g., the
+/// experiment's ScoreMatrix) and are final, so calls made through the concrete type (as the experiment does) are
+/// statically dispatched.
 struct BaseSelect {
   emp::vector<size_t> selected;
   std::string name="BaseSelect";
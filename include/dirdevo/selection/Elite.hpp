@@ -2,7 +2,8 @@
 #ifndef DIRECTED_DEVO_SELECTION_DIRECTED_DEVO_ELITE_HPP_INCLUDE
 #define DIRECTED_DEVO_SELECTION_DIRECTED_DEVO_ELITE_HPP_INCLUDE
 
-#include <map>
+#include <algorithm>
+#include <numeric>
 
 #include "emp/base/vector.hpp"
 
@@ -10,44 +11,45 @@
 
 namespace dirdevo {
 
-struct EliteSelect : public BaseSelect {
-  using score_fun_t = std::function<double(void)>;
+/// Select the top elite_count candidates (by score), repeating them in rank order to fill the n selection slots.
+/// Ties are broken in favor of the candidate with the larger id.
+struct EliteSelect final : public BaseSelect {
 
-  emp::vector<score_fun_t>& score_funs; ///< One function for each selection candidate (e.g., each member of the population)
-  size_t elite_count;                  ///< How many distinct candidates should be chosen (in rank order by score)
+  const emp::vector<double>& scores;  ///< One score for each selection candidate (e.g., each member of the population)
+  size_t elite_count;                 ///< How many distinct candidates should be chosen (in rank order by score)
+
+  emp::vector<size_t> candidate_ids;  ///< Used internally (reused across calls to avoid reallocating)
 
   EliteSelect(
-    emp::vector<score_fun_t>& a_score_funs,
+    const emp::vector<double>& a_scores,
     size_t a_elite_count=1
   ) :
-    score_funs(a_score_funs),
+    scores(a_scores),
     elite_count(a_elite_count)
   { }
 
   emp::vector<size_t>& operator()(size_t n) override {
-    emp_assert(elite_count <= score_funs.size(), elite_count, score_funs.size());
+    emp_assert(elite_count <= scores.size(), elite_count, scores.size());
 
     selected.resize(n, 0);
 
-    const size_t num_candidates = score_funs.size();
+    const size_t num_candidates = scores.size();
 
-    std::multimap<double, size_t> fit_map;
-    for (size_t id = 0; id < num_candidates; ++id) {
-      fit_map.insert(
-        std::make_pair(score_funs[id](), id)
-      );
-    }
+    // Rank only as many candidates as we need.
+    candidate_ids.resize(num_candidates);
+    std::iota(candidate_ids.begin(), candidate_ids.end(), 0);
+    std::partial_sort(
+      candidate_ids.begin(),
+      candidate_ids.begin() + elite_count,
+      candidate_ids.end(),
+      [this](size_t a, size_t b) {
+        return (scores[a] == scores[b]) ? a > b : scores[a] > scores[b];
+      }
+    );
 
-    // Identify the elites
-    emp::vector<size_t> elites(elite_count, 0);
-    auto m = fit_map.rbegin();
-    for (size_t i = 0; i < elite_count; ++i) {
-      elites[i] = m->second;
-      ++m;
-    }
     // Fill selected with elites
     for (size_t i = 0; i < n; ++i) {
-      selected[i] = elites[i % elite_count];
+      selected[i] = candidate_ids[i % elite_count];
     }
 
     return selected;
@@ -2,51 +2,70 @@
 
 #include <functional>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
 
 #include "emp/base/vector.hpp"
 #include "emp/math/Random.hpp"
 #include "emp/math/random_utils.hpp"
 
 #include "BaseSelect.hpp"
+#include "../utility/ScoreMatrix.hpp"
 
 namespace dirdevo {
 
-struct LexicaseSelect : public BaseSelect {
+/// Lexicase selection (optionally, epsilon-lexicase selection).
+///
+/// Each selection event, every objective is ranked once: for each distinct score level on an objective, we store
+/// (as a bitset) the candidates that score at least that well. Filtering a candidate pool on an objective is then
+/// a binary search for the best level present in the pool followed by a single bitset AND.
+/// Filtered pools are memoized in a trie keyed on function ordering prefixes, so selections that share a prefix of
+/// their (shuffled) function ordering share the filtering work (e.g., the first filtering step is only ever done
+/// once per objective).
+///
+/// epsilon: candidates within epsilon of the best score in the pool survive each filtering step. If epsilon is
+/// negative, each objective uses the median absolute deviation of its scores (semi-dynamic epsilon lexicase).
+/// epsilon = 0 is standard lexicase (and selects exactly what the old pool-copying implementation did, given the
+/// same random number generator state).
+struct LexicaseSelect final : public BaseSelect {
+
+  static constexpr size_t NO_NODE = (size_t)-1;
+
+  const ScoreMatrix& score_table;                   ///< One row per candidate, one column per function
+  emp::Random& random;
+  double epsilon;
 
-  using score_fun_t = std::function<double(void)>;
+  emp::vector<size_t> fun_ordering;                 ///< Used internally to track function ordering. WARNING - Don't change values in this!
 
-  emp::vector< emp::vector<score_fun_t> >& score_fun_sets;
-  emp::Random& random;
+  size_t num_words=0;                               ///< Number of 64-bit words in each candidate bitset
+  emp::vector< emp::vector<double> > fun_levels;    ///< Distinct scores on each function (best first)
+  emp::vector< emp::vector<size_t> > fun_cutoffs;   ///< For each function level, the last level within epsilon of it
+  emp::vector< emp::vector<uint64_t> > fun_at_least;///< For each function level, bitset of candidates scoring at least that well
 
-  emp::vector< emp::vector<double> > score_table;
+  emp::vector<uint64_t> node_bits;                  ///< Memoized candidate pools (one bitset per trie node; node 0 = everyone)
+  emp::vector<size_t> node_counts;                  ///< Number of candidates in each memoized pool
+  emp::vector<size_t> node_children;                ///< node_children[node * fun_cnt + fun_id] = pool after also filtering on fun_id
 
-  emp::vector<size_t> fun_ordering;                 ///< Used internally to track function ordering. WARNING - Don't change values in this!
-  emp::vector<size_t> all_candidates;               ///< Used internally to track complete set of candidate ids.
+  emp::vector<size_t> fun_candidates;               ///< Used internally (scratch space for ranking functions)
+  emp::vector<double> fun_column;                   ///< Used internally (scratch space for ranking functions)
+  emp::vector<double> fun_deviations;               ///< Used internally (scratch space for computing median absolute deviations)
 
   LexicaseSelect(
-    emp::vector< emp::vector<score_fun_t> >& a_score_fun_sets,
-    emp::Random& a_random
+    const ScoreMatrix& a_score_table,
+    emp::Random& a_random,
+    double a_epsilon=0.0
   ) :
-    score_fun_sets(a_score_fun_sets),
-    random(a_random)
+    score_table(a_score_table),
+    random(a_random),
+    epsilon(a_epsilon)
   { }
 
   emp::vector<size_t>& operator()(size_t n) override {
     selected.resize(n, 0);
-    const size_t num_candidates = score_fun_sets.size(); // How many candidates are there to select from?
+    const size_t num_candidates = score_table.GetNumRows(); // How many candidates are there to select from?
     emp_assert(num_candidates > 0);
-    const size_t fun_cnt = score_fun_sets[0].size();
-
-    // Update the score table.
-    score_table.resize(fun_cnt);
-
-    for (size_t fun_i = 0; fun_i < fun_cnt; ++fun_i) {
-      score_table[fun_i].resize(num_candidates);
-      for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
-        emp_assert(fun_cnt == score_fun_sets[cand_i].size());
-        score_table[fun_i][cand_i] = score_fun_sets[cand_i][fun_i]();
-      }
-    }
+    const size_t fun_cnt = score_table.GetNumCols();
 
     // Update function ordering if necessary
     if (fun_cnt != fun_ordering.size()) {
@@ -58,51 +77,163 @@ struct LexicaseSelect : public BaseSelect {
       );
     }
 
-    if (all_candidates.size() != num_candidates) {
-      all_candidates.resize(num_candidates);
-      std::iota(
-        all_candidates.begin(),
-        all_candidates.end(),
-        0
-      );
+    RankFunctions();
+
+    // Reset the memo trie (scores may have changed since the last selection event).
+    node_bits.assign(num_words, 0);
+    for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
+      node_bits[cand_i / 64] |= (uint64_t)1 << (cand_i % 64);
     }
+    node_counts.assign(1, num_candidates);
+    node_children.assign(fun_cnt, NO_NODE);
 
-    emp::vector<size_t> cur_pool, next_pool;
     for (size_t sel_i = 0; sel_i < n; ++sel_i) {
       // Randomize the function ordering
       emp::Shuffle(random, fun_ordering);
-      // Step through each function
-      cur_pool = all_candidates;
-      int depth = -1;
-      // For each function, filter the population down to only the best performers.
+      // For each function, filter the pool down to only the best performers.
+      size_t node = 0;
       for (size_t fun_id : fun_ordering) {
-        ++depth;
-        double max_score = score_table[fun_id][cur_pool[0]]; // Max score starts as the first candidate's score on this function.
-        next_pool.push_back(cur_pool[0]);                    // Seed the keeper pool with the first candidate.
-
-        for (size_t i = 1; i < cur_pool.size(); ++i) {
-          const size_t cand_id = cur_pool[i];
-          const double cur_score = score_table[fun_id][cand_id];
-          if (cur_score > max_score) {
-            max_score = cur_score;              // This is the new max score for this function
-            next_pool.resize(1);                // Clear out candidates with the former max score for this function.
-            next_pool[0] = cand_id;             // Add this candidate as the only one with the new max score.
-          } else if (cur_score == max_score) {
-            next_pool.emplace_back(cand_id);    // Same as current max score. Save this candidate too.
-          }
+        size_t child = node_children[node * fun_cnt + fun_id];
+        if (child == NO_NODE) {
+          child = Filter(node, fun_id);
+          node_children[node * fun_cnt + fun_id] = child;
         }
-        // Make next_pool into new cur_pool; make cur_pool allocated space for next_pool
-        std::swap(cur_pool, next_pool);
-        next_pool.resize(0);
-        if (cur_pool.size() == 1) break; // Step if we're down to just one candidate.
+        node = child;
+        if (node_counts[node] == 1) break; // Stop if we're down to just one candidate.
       }
       // Select a random survivor (all equal at this point)
-      emp_assert(cur_pool.size() > 0);
-      const size_t win_id = cur_pool[random.GetUInt(cur_pool.size())];
-      selected[sel_i] = win_id;
+      emp_assert(node_counts[node] > 0);
+      selected[sel_i] = GetNthCandidate(node, random.GetUInt(node_counts[node]));
     }
     return selected;
   }
+
+protected:
+
+  /// For each function: find the distinct score levels, which candidates score at least as well as each level, and
+  /// (for each level) the worst level that is within epsilon of it.
+  void RankFunctions() {
+    const size_t num_candidates = score_table.GetNumRows();
+    const size_t fun_cnt = score_table.GetNumCols();
+    num_words = (num_candidates + 63) / 64;
+    fun_levels.resize(fun_cnt);
+    fun_cutoffs.resize(fun_cnt);
+    fun_at_least.resize(fun_cnt);
+    fun_candidates.resize(num_candidates);
+    fun_column.resize(num_candidates);
+    for (size_t fun_id = 0; fun_id < fun_cnt; ++fun_id) {
+      auto& levels = fun_levels[fun_id];
+      auto& at_least = fun_at_least[fun_id];
+      for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) fun_column[cand_i] = score_table(cand_i, fun_id);
+      std::iota(fun_candidates.begin(), fun_candidates.end(), 0);
+      std::sort(
+        fun_candidates.begin(),
+        fun_candidates.end(),
+        [this](size_t a, size_t b) { return fun_column[a] > fun_column[b]; }
+      );
+      // Walk candidates from best to worst: each new score starts a new level, which starts with everyone in the
+      // previous level.
+      levels.clear();
+      at_least.clear();
+      for (size_t cand_id : fun_candidates) {
+        const double score = fun_column[cand_id];
+        if (levels.empty() || score != levels.back()) {
+          levels.emplace_back(score);
+          at_least.resize(levels.size() * num_words, 0);
+          if (levels.size() > 1) {
+            std::copy(
+              at_least.end() - 2 * (std::ptrdiff_t)num_words,
+              at_least.end() - (std::ptrdiff_t)num_words,
+              at_least.end() - (std::ptrdiff_t)num_words
+            );
+          }
+        }
+        at_least[(levels.size() - 1) * num_words + cand_id / 64] |= (uint64_t)1 << (cand_id % 64);
+      }
+      // Which levels survive alongside each level?
+      const double fun_epsilon = (epsilon < 0) ? MedianAbsoluteDeviation(fun_id) : epsilon;
+      auto& cutoffs = fun_cutoffs[fun_id];
+      cutoffs.resize(levels.size());
+      size_t cutoff = 0;
+      for (size_t level = 0; level < levels.size(); ++level) {
+        cutoff = std::max(cutoff, level);
+        while (cutoff + 1 < levels.size() && levels[cutoff + 1] >= levels[level] - fun_epsilon) ++cutoff;
+        cutoffs[level] = cutoff;
+      }
+    }
+  }
+
+  /// Median absolute deviation of all candidates' scores on the given function.
+  double MedianAbsoluteDeviation(size_t fun_id) {
+    const size_t num_candidates = score_table.GetNumRows();
+    fun_deviations.resize(num_candidates);
+    for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) fun_deviations[cand_i] = score_table(cand_i, fun_id);
+    auto median = [this]() {
+      auto mid = fun_deviations.begin() + fun_deviations.size() / 2;
+      std::nth_element(fun_deviations.begin(), mid, fun_deviations.end());
+      return *mid;
+    };
+    const double med = median();
+    for (double& score : fun_deviations) score = std::abs(score - med);
+    return median();
+  }
+
+  /// Filter the pool at the given node on the given function; returns the (new) node holding the survivors.
+  size_t Filter(size_t node, size_t fun_id) {
+    const auto& at_least = fun_at_least[fun_id];
+    auto in_pool = [this, &at_least, node](size_t level) {
+      const uint64_t* pool = node_bits.data() + node * num_words;
+      const uint64_t* level_bits = at_least.data() + level * num_words;
+      for (size_t w = 0; w < num_words; ++w) {
+        if (pool[w] & level_bits[w]) return true;
+      }
+      return false;
+    };
+    // Levels are nested, so binary search for the best level that anyone in the pool reaches.
+    size_t low = 0;
+    size_t high = fun_levels[fun_id].size() - 1;
+    while (low < high) {
+      const size_t mid = low + (high - low) / 2;
+      if (in_pool(mid)) {
+        high = mid;
+      } else {
+        low = mid + 1;
+      }
+    }
+    const size_t cutoff = fun_cutoffs[fun_id][low];
+    // Survivors: everyone in the pool at least as good as the cutoff level.
+    const size_t child = node_counts.size();
+    node_bits.resize(node_bits.size() + num_words);
+    const uint64_t* pool = node_bits.data() + node * num_words;
+    const uint64_t* level_bits = at_least.data() + cutoff * num_words;
+    uint64_t* child_bits = node_bits.data() + child * num_words;
+    size_t count = 0;
+    for (size_t w = 0; w < num_words; ++w) {
+      child_bits[w] = pool[w] & level_bits[w];
+      count += (size_t)__builtin_popcountll(child_bits[w]);
+    }
+    node_counts.emplace_back(count);
+    node_children.resize(node_children.size() + score_table.GetNumCols(), NO_NODE);
+    return child;
+  }
+
+  /// Get the id of the nth (in ascending id order) candidate in the pool at the given node.
+  size_t GetNthCandidate(size_t node, size_t nth) const {
+    const uint64_t* pool = node_bits.data() + node * num_words;
+    for (size_t w = 0; w < num_words; ++w) {
+      const size_t word_count = (size_t)__builtin_popcountll(pool[w]);
+      if (nth >= word_count) {
+        nth -= word_count;
+        continue;
+      }
+      uint64_t bits = pool[w];
+      for (size_t i = 0; i < nth; ++i) bits &= bits - 1; // Clear the lowest set bit.
+      return w * 64 + (size_t)__builtin_ctzll(bits);
+    }
+    emp_assert(false, "Candidate index out of range.", nth);
+    return 0;
+  }
+
 };
 
-} // End dirdevo namespace
\ No newline at end of file
+} // End dirdevo namespace
@@ -8,7 +8,7 @@ namespace dirdevo {
 
   /// Performs no selection. I.e., everything is selected.
   /// Assumes n == number of candidates for selection
-  struct NoSelect : public BaseSelect {
+  struct NoSelect final : public BaseSelect {
 
     emp::vector<size_t>& operator()(size_t n) override {
       selected.resize(n, 0);
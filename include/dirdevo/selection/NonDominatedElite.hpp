@@ -10,46 +10,33 @@
 
 #include "BaseSelect.hpp"
 #include "../utility/pareto.hpp"
+#include "../utility/ScoreMatrix.hpp"
 
 namespace dirdevo {
 
 /// Multiobjective selection scheme.
 /// Find the set of non-dominated candidates (i.e., elites) and select them.
-struct NonDominatedEliteSelect : public BaseSelect {
-  using score_fun_t = std::function<double(void)>;
+struct NonDominatedEliteSelect final : public BaseSelect {
 
-  emp::vector< emp::vector<score_fun_t> >& score_fun_sets;
-  emp::Random& random;    ///< When front size does not evenly fit into selected, use random to determine which things in the front fill the gap
+  const ScoreMatrix& score_table;  ///< One row per candidate, one column per objective
+  emp::Random& random;             ///< When front size does not evenly fit into selected, use random to determine which things in the front fill the gap
 
-  emp::vector< emp::vector<double> > score_table;
-  // emp::vector<size_t> all_candidates;
+  emp::vector<size_t> front;
 
   NonDominatedEliteSelect(
-    emp::vector< emp::vector<score_fun_t> >& a_score_fun_sets,
+    const ScoreMatrix& a_score_table,
     emp::Random& a_random
   ) :
-    score_fun_sets(a_score_fun_sets),
+    score_table(a_score_table),
     random(a_random)
   {  }
 
   emp::vector<size_t>& operator()(size_t n) override {
     selected.resize(n, 0);
-    const size_t num_candidates = score_fun_sets.size();
-    emp_assert(num_candidates > 0);
-    const size_t obj_cnt = score_fun_sets[0].size();
-
-    // update the score table
-    score_table.resize(num_candidates);
-    for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
-      score_table[cand_i].resize(obj_cnt);
-      for (size_t fun_i = 0; fun_i < obj_cnt; ++fun_i) {
-        emp_assert(obj_cnt == score_fun_sets[cand_i].size());
-        score_table[cand_i][fun_i] = score_fun_sets[cand_i][fun_i]();
-      }
-    }
+    emp_assert(score_table.GetNumRows() > 0);
 
     // find the pareto front
-    emp::vector<size_t> front(dirdevo::find_pareto_front(score_table));
+    dirdevo::find_pareto_front_fast(score_table, front);
     emp::Shuffle(random, front);
     const size_t front_size = front.size();
     // select the front
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef DIRECTED_DEVO_SELECTION_DIRECTED_DEVO_NON_DOMINATED_SORTING_HPP_INCLUDE
+#define DIRECTED_DEVO_SELECTION_DIRECTED_DEVO_NON_DOMINATED_SORTING_HPP_INCLUDE
+
+#include <algorithm>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "BaseSelect.hpp"
+#include "../utility/pareto.hpp"
+#include "../utility/ScoreMatrix.hpp"
+
+namespace dirdevo {
+
+/// Multiobjective selection scheme (NSGA-II style).
+/// Sort all candidates into non-dominated fronts and compute crowding distances within each front. Then, run
+/// tournaments: the entrant in the best (lowest) front wins; ties are broken by larger crowding distance.
+struct NonDominatedSortingSelect final : public BaseSelect {
+
+  const ScoreMatrix& score_table;             ///< One row per candidate, one column per objective
+  emp::Random& random;
+  size_t tournament_size;
+
+  emp::vector< emp::vector<size_t> > fronts;  ///< Candidate ids in each front (fronts[0] is the pareto front)
+  emp::vector<size_t> ranks;                  ///< Front index of each candidate
+  emp::vector<double> crowding;               ///< Crowding distance of each candidate (within its front)
+
+  NonDominatedSortingSelect(
+    const ScoreMatrix& a_score_table,
+    emp::Random& a_random,
+    size_t a_tournament_size=2
+  ) :
+    score_table(a_score_table),
+    random(a_random),
+    tournament_size(a_tournament_size)
+  { }
+
+  emp::vector<size_t>& operator()(size_t n) override {
+    emp_assert(tournament_size > 0, "Tournament size must be greater than 0.", tournament_size);
+    selected.resize(n, 0);
+    const size_t num_candidates = score_table.GetNumRows();
+    emp_assert(num_candidates > 0);
+
+    // rank everything
+    dirdevo::non_dominated_sort(score_table, fronts, ranks);
+    crowding.resize(num_candidates);
+    for (const auto& front : fronts) {
+      dirdevo::crowding_distances(score_table, front, crowding);
+    }
+
+    // run tournaments
+    for (size_t t = 0; t < n; ++t) {
+      size_t winner_id = random.GetUInt(num_candidates);
+      for (size_t i = 1; i < tournament_size; ++i) {
+        const size_t entry_id = random.GetUInt(num_candidates);
+        if (Beats(entry_id, winner_id)) winner_id = entry_id;
+      }
+      selected[t] = winner_id;
+    }
+    return selected;
+  }
+
+  /// Crowded comparison: does candidate a beat candidate b?
+  bool Beats(size_t a, size_t b) const {
+    if (ranks[a] != ranks[b]) return ranks[a] < ranks[b];
+    return crowding[a] > crowding[b];
+  }
+
+  const emp::vector< emp::vector<size_t> >& GetFronts() const { return fronts; }
+  const emp::vector<size_t>& GetRanks() const { return ranks; }
+  const emp::vector<double>& GetCrowdingDistances() const { return crowding; }
+
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_SELECTION_DIRECTED_DEVO_NON_DOMINATED_SORTING_HPP_INCLUDE
@@ -7,7 +7,7 @@
 #include "BaseSelect.hpp"
 
 namespace dirdevo {
-  struct RandomSelect : public BaseSelect {
+  struct RandomSelect final : public BaseSelect {
 
     emp::Random& random;
     size_t num_candidates;
@@ -7,6 +7,7 @@
 #include "NonDominatedElite.hpp"
 #include "Tournament.hpp"
 #include "NonDominatedTournament.hpp"
+#include "NonDominatedSorting.hpp"
 #include "Random.hpp"
 #include "NoSelect.hpp"
 
@@ -11,49 +11,51 @@
 namespace dirdevo {
 
 
-struct TournamentSelect : public BaseSelect {
+/// Run n tournaments (entrants drawn uniformly at random, with replacement); the highest scoring entrant in each
+/// tournament is selected (ties go to the entrant drawn first).
+struct TournamentSelect final : public BaseSelect {
 
-  using score_fun_t = std::function<double(void)>;
-
-  emp::vector<score_fun_t>& score_funs;     ///< One function for each selection candidate (e.g., each member of the population)
+  const emp::vector<double>& scores;        ///< One score for each selection candidate (e.g., each member of the population)
   emp::Random& random;
   size_t tournament_size;
 
+  emp::vector<size_t> entries;              ///< Entrants for every tournament (reused across calls to avoid reallocating)
+
   TournamentSelect(
-    emp::vector<score_fun_t>& a_score_funs,
+    const emp::vector<double>& a_scores,
     emp::Random& a_random,
     size_t a_tournament_size=4
   ) :
-    score_funs(a_score_funs),
+    scores(a_scores),
     random(a_random),
     tournament_size(a_tournament_size)
   { }
 
   emp::vector<size_t>& operator()(size_t n) override {
     emp_assert(tournament_size > 0, "Tournament size must be greater than 0.", tournament_size);
-    emp_assert(tournament_size <= score_funs.size(), "Tournament size should not exceed number of individuals that we can select from.", tournament_size, score_funs.size());
+    emp_assert(tournament_size <= scores.size(), "Tournament size should not exceed number of individuals that we can select from.", tournament_size, scores.size());
 
-    const size_t num_candidates = score_funs.size();
+    const size_t num_candidates = scores.size();
 
     selected.resize(n, 0); // Update size of selected
 
-    emp::vector<size_t> entries(tournament_size, 0); // Used to keep track of tournament entries for each tournament
+    // Draw the entrants for all n tournaments at once (in the same order as running tournaments one at a time).
+    entries.resize(n * tournament_size);
+    for (size_t& entry : entries) {
+      entry = random.GetUInt(num_candidates);
+    }
 
     for (size_t t=0; t < n; ++t) {
-      // form a tournament
-      std::generate(
-        entries.begin(),
-        entries.end(),
-        [this, num_candidates](){ return random.GetUInt(num_candidates); }
-      );
       // pick a winner
-      size_t winner_id = entries[0];
-      double winner_fit = score_funs[entries[0]]();
-      for (size_t i = 1; i < entries.size(); ++i) {
-        const size_t entry_id = entries[i];
-        const double entry_fit = score_funs[entry_id]();
+      const size_t* tournament = entries.data() + t * tournament_size;
+      size_t winner_id = tournament[0];
+      double winner_fit = scores[winner_id];
+      for (size_t i = 1; i < tournament_size; ++i) {
+        const size_t entry_id = tournament[i];
+        const double entry_fit = scores[entry_id];
         if (entry_fit > winner_fit) {
           winner_id = entry_id;
+          winner_fit = entry_fit;
         }
       }
       // save winner of tournament t
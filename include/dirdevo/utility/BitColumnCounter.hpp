@@ -0,0 +1,92 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_BIT_COLUMN_COUNTER_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_BIT_COLUMN_COUNTER_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+/// Counts, for each bit position, how many of a series of equal-length bit strings have that bit set (e.g., the
+/// number of ones at each genome site across a population).
+///
+/// Counts are kept bit-sliced (a vertical counter): for each 64-bit word of the bit strings, plane p holds bit p of
+/// the running count of each of the word's 64 positions. Adding a bit string is then a ripple-carry add of each of its
+/// words into that word's planes (a couple of AND/XORs per word, on average), rather than one add per bit.
+/// Planes are flushed into the per-position totals before they can overflow.
+class BitColumnCounter {
+public:
+  static constexpr size_t NUM_PLANES = 16;                        ///< Bits per sliced counter
+  static constexpr size_t MAX_PENDING = ((size_t)1 << NUM_PLANES) - 1; ///< Bit strings that can be added between flushes
+
+protected:
+  size_t num_bits=0;
+  size_t num_words=0;
+  size_t pending=0;                 ///< Bit strings added since the last flush
+  emp::vector<uint64_t> planes;     ///< planes[word * NUM_PLANES + p] = bit p of each of the word's position counts
+  emp::vector<size_t> totals;       ///< Flushed counts (one per bit position)
+
+  void Flush() {
+    for (size_t word = 0; word < num_words; ++word) {
+      uint64_t* word_planes = planes.data() + word * NUM_PLANES;
+      const size_t word_bits = std::min<size_t>(64, num_bits - word * 64);
+      for (size_t p = 0; p < NUM_PLANES; ++p) {
+        uint64_t plane = word_planes[p];
+        while (plane) {
+          const size_t bit = (size_t)__builtin_ctzll(plane);
+          emp_assert(bit < word_bits);
+          totals[word * 64 + bit] += (size_t)1 << p;
+          plane &= plane - 1;
+        }
+        word_planes[p] = 0;
+      }
+    }
+    pending = 0;
+  }
+
+public:
+  BitColumnCounter(size_t bits=0) { Reset(bits); }
+
+  /// Clear all counts (and set the number of bit positions).
+  void Reset(size_t bits) {
+    num_bits = bits;
+    num_words = (bits + 63) / 64;
+    pending = 0;
+    planes.assign(num_words * NUM_PLANES, 0);
+    totals.assign(num_bits, 0);
+  }
+
+  size_t GetNumBits() const { return num_bits; }
+  size_t GetNumWords() const { return num_words; }
+
+  /// Add one bit string, given as a function from word index (0 to GetNumWords()-1) to 64-bit word (bit i of word w
+  /// is position w*64+i; positions past GetNumBits() must be 0).
+  template<typename GET_WORD_T>
+  void Add(GET_WORD_T&& get_word) {
+    if (pending == MAX_PENDING) Flush();
+    for (size_t word = 0; word < num_words; ++word) {
+      uint64_t carry = get_word(word);
+      uint64_t* word_planes = planes.data() + word * NUM_PLANES;
+      for (size_t p = 0; carry; ++p) {
+        emp_assert(p < NUM_PLANES);
+        const uint64_t next_carry = word_planes[p] & carry;
+        word_planes[p] ^= carry;
+        carry = next_carry;
+      }
+    }
+    ++pending;
+  }
+
+  /// Per-position counts (flushes any pending counts).
+  const emp::vector<size_t>& GetCounts() {
+    if (pending) Flush();
+    return totals;
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_BIT_COLUMN_COUNTER_HPP_INCLUDE
@@ -0,0 +1,81 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_BYTE_BUFFER_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_BYTE_BUFFER_HPP_INCLUDE
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "emp/base/assert.hpp"
+
+namespace dirdevo {
+
+/// Appends trivially copyable values to a byte buffer (stored in a std::string).
+/// Used to move scores and genomes between processes and in/out of binary files.
+/// NOTE - values are written in native byte order (all processes are expected to run on the same machine type).
+class ByteWriter {
+protected:
+  std::string& buffer; ///< NON-OWNING. Buffer to append to.
+
+public:
+  ByteWriter(std::string& buf) : buffer(buf) { ; }
+
+  template<typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "ByteWriter can only write trivially copyable types.");
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  /// Write a length-prefixed string
+  void WriteString(const std::string& str) {
+    Write<uint64_t>(str.size());
+    buffer.append(str);
+  }
+
+  size_t GetSize() const { return buffer.size(); }
+};
+
+/// Reads values written by a ByteWriter. Does not own the underlying bytes.
+class ByteReader {
+protected:
+  const char* data=nullptr;
+  size_t size=0;
+  size_t pos=0;
+
+public:
+  ByteReader(const char* d, size_t s) : data(d), size(s) { ; }
+  ByteReader(const std::string& buf) : data(buf.data()), size(buf.size()) { ; }
+
+  template<typename T>
+  T Read() {
+    static_assert(std::is_trivially_copyable<T>::value, "ByteReader can only read trivially copyable types.");
+    emp_assert(pos + sizeof(T) <= size, "Attempting to read past end of buffer.", pos, size);
+    T value;
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+  }
+
+  std::string ReadString() {
+    const size_t len = Read<uint64_t>();
+    emp_assert(pos + len <= size, "Attempting to read past end of buffer.", pos, len, size);
+    std::string str(data + pos, len);
+    pos += len;
+    return str;
+  }
+
+  /// Skip over the next num_bytes bytes.
+  void Skip(size_t num_bytes) {
+    emp_assert(pos + num_bytes <= size);
+    pos += num_bytes;
+  }
+
+  size_t GetPos() const { return pos; }
+  size_t GetSize() const { return size; }
+  bool AtEnd() const { return pos >= size; }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_BYTE_BUFFER_HPP_INCLUDE
@@ -0,0 +1,239 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_CSV_READER_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_CSV_READER_HPP_INCLUDE
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+#include "MappedFile.hpp"
+
+namespace dirdevo {
+
+/// Streaming reader for (potentially very large) .csv files, e.g., for analysis tools.
+/// - The file is memory-mapped; rows are parsed in place, and fields are handed out as string_views into the file
+///   (valid until the reader is closed), so parsing a row doesn't allocate.
+/// - Only the requested columns are extracted from each row (the rest of the row is skipped).
+/// - The rows can be split into chunks (at row boundaries) to parse on multiple threads.
+/// Fields may be double-quoted (to hold commas); the quotes are stripped, but doubled quotes ("") inside a quoted field
+/// are left as is. Quoted fields can't span lines.
+class CsvReader {
+public:
+  static constexpr size_t NO_COLUMN = (size_t)-1;
+
+  /// A contiguous run of whole rows.
+  struct Chunk {
+    const char* begin=nullptr;
+    const char* end=nullptr;
+  };
+
+  /// The requested fields of one row (in the order the columns were requested).
+  class Row {
+    friend class CsvReader;
+  protected:
+    emp::vector<std::string_view> fields;
+
+  public:
+    size_t GetNumFields() const { return fields.size(); }
+
+    std::string_view operator[](size_t i) const {
+      emp_assert(i < fields.size(), i, fields.size());
+      return fields[i];
+    }
+
+    /// Parse the i'th requested field as a number. Returns false (leaving value unchanged) if it isn't one.
+    template<typename T>
+    bool Get(size_t i, T& value) const {
+      static_assert(std::is_arithmetic<T>::value, "Row::Get only parses numbers.");
+      const std::string_view field = (*this)[i];
+      const auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+      return (result.ec == std::errc()) && (result.ptr == field.data() + field.size());
+    }
+
+    /// Parse the i'th requested field as a number (or return fallback if it isn't one).
+    template<typename T>
+    T GetAs(size_t i, T fallback=T()) const {
+      T value = fallback;
+      return (Get(i, value)) ? value : fallback;
+    }
+  };
+
+protected:
+  MappedFile file;
+  emp::vector<std::string> header;
+  Chunk body;                       ///< Everything after the header line
+  std::string error;
+
+  bool Fail(const std::string& msg) {
+    Close();
+    error = msg;
+    return false;
+  }
+
+  /// End of the line starting at pos (position of its '\n', or end).
+  static const char* LineEnd(const char* pos, const char* end) {
+    const void* newline = std::memchr(pos, '\n', (size_t)(end - pos));
+    return (newline) ? static_cast<const char*>(newline) : end;
+  }
+
+  /// Parse the field starting at pos (within a line ending at line_end). Returns the position after the field's
+  /// delimiter (or line_end).
+  static const char* ParseField(const char* pos, const char* line_end, std::string_view& field) {
+    if (pos < line_end && *pos == '"') {
+      // Quoted: ends at the first quote that isn't doubled.
+      const char* field_begin = ++pos;
+      while (pos < line_end) {
+        if (*pos == '"') {
+          if (pos + 1 < line_end && pos[1] == '"') {
+            pos += 2;
+            continue;
+          }
+          break;
+        }
+        ++pos;
+      }
+      field = std::string_view(field_begin, (size_t)(pos - field_begin));
+      const void* comma = (pos < line_end) ? std::memchr(pos, ',', (size_t)(line_end - pos)) : nullptr;
+      return (comma) ? static_cast<const char*>(comma) + 1 : line_end;
+    }
+    const void* comma = std::memchr(pos, ',', (size_t)(line_end - pos));
+    const char* field_end = (comma) ? static_cast<const char*>(comma) : line_end;
+    field = std::string_view(pos, (size_t)(field_end - pos));
+    return (comma) ? field_end + 1 : line_end;
+  }
+
+  /// Line from begin to end, without a trailing '\r'
+  static const char* TrimLineEnd(const char* begin, const char* end) {
+    return (end > begin && end[-1] == '\r') ? end - 1 : end;
+  }
+
+public:
+  CsvReader() = default;
+  CsvReader(const std::string& path) { Open(path); }
+
+  /// Map the file at path and read its header. On failure (including a header that names the same column twice),
+  /// returns false (see GetError for why).
+  bool Open(const std::string& path) {
+    Close();
+    error.clear();
+    if (!file.Open(path)) return Fail(file.GetError());
+    if (!file.GetSize()) return Fail(path + ": empty file (no header)");
+    file.AdviseSequential();
+    const char* begin = file.GetData();
+    const char* end = begin + file.GetSize();
+    const char* header_end = LineEnd(begin, end);
+    const char* line_end = TrimLineEnd(begin, header_end);
+    for (const char* pos = begin; pos < line_end;) {
+      std::string_view name;
+      pos = ParseField(pos, line_end, name);
+      // Columns are looked up by name, so a repeated name would quietly hide one of its columns.
+      if (std::find(header.begin(), header.end(), name) != header.end()) {
+        return Fail(path + ": duplicate column name in header (" + std::string(name) + ")");
+      }
+      header.emplace_back(name);
+    }
+    body.begin = (header_end < end) ? header_end + 1 : end;
+    body.end = end;
+    return true;
+  }
+
+  void Close() {
+    file.Close();
+    header.clear();
+    body = Chunk();
+  }
+
+  bool IsOpen() const { return file.IsOpen(); }
+  const std::string& GetError() const { return error; }
+
+  const emp::vector<std::string>& GetHeader() const { return header; }
+
+  /// Index of the named column (NO_COLUMN if there isn't one).
+  size_t GetColumn(std::string_view name) const {
+    auto it = std::find(header.begin(), header.end(), name);
+    return (it == header.end()) ? NO_COLUMN : (size_t)(it - header.begin());
+  }
+
+  /// Indices of the named columns. Sets missing to the first name not found (if any).
+  emp::vector<size_t> GetColumns(const emp::vector<std::string>& names, std::string& missing) const {
+    emp::vector<size_t> columns;
+    missing.clear();
+    for (const auto& name : names) {
+      columns.emplace_back(GetColumn(name));
+      if (columns.back() == NO_COLUMN && missing.empty()) missing = name;
+    }
+    return columns;
+  }
+
+  /// All rows (everything after the header).
+  Chunk GetBody() const { return body; }
+
+  /// Split the rows into (at most) num_chunks chunks of roughly equal size. Chunks are in file order.
+  emp::vector<Chunk> Split(size_t num_chunks) const {
+    emp::vector<Chunk> chunks;
+    const size_t body_size = (size_t)(body.end - body.begin);
+    num_chunks = std::max<size_t>(1, std::min(num_chunks, body_size));
+    const char* begin = body.begin;
+    for (size_t i = 1; i <= num_chunks && begin < body.end; ++i) {
+      // Chunks end at the end of the line containing their (approximate) end.
+      const char* approx_end = body.begin + (body_size * i) / num_chunks;
+      const char* end = (approx_end <= begin) ? begin : approx_end - 1;
+      end = (i == num_chunks) ? body.end : std::min(LineEnd(end, body.end) + 1, body.end);
+      if (end > begin) chunks.push_back({begin, end});
+      begin = end;
+    }
+    return chunks;
+  }
+
+  /// Call fun(const Row&) for each row in the chunk, where the row holds the given columns' fields (a column that's
+  /// missing from a row, or is NO_COLUMN, gives an empty field). Blank lines are skipped. Returns the number of rows.
+  template<typename FUN>
+  size_t ForEachRow(const Chunk& chunk, const emp::vector<size_t>& columns, FUN&& fun) const {
+    // Where does each column go in the row?
+    size_t last_column = 0;
+    for (size_t column : columns) {
+      if (column != NO_COLUMN) last_column = std::max(last_column, column);
+    }
+    emp::vector<size_t> slots(last_column + 1, NO_COLUMN);
+    for (size_t slot = 0; slot < columns.size(); ++slot) {
+      if (columns[slot] != NO_COLUMN) slots[columns[slot]] = slot;
+    }
+
+    Row row;
+    row.fields.resize(columns.size());
+    size_t num_rows = 0;
+    for (const char* pos = chunk.begin; pos < chunk.end;) {
+      const char* newline = LineEnd(pos, chunk.end);
+      const char* line_end = TrimLineEnd(pos, newline);
+      if (line_end > pos) {
+        std::fill(row.fields.begin(), row.fields.end(), std::string_view());
+        std::string_view field;
+        const char* field_pos = pos;
+        for (size_t column = 0; column <= last_column && field_pos < line_end; ++column) {
+          field_pos = ParseField(field_pos, line_end, field);
+          if (slots[column] != NO_COLUMN) row.fields[slots[column]] = field;
+        }
+        fun(static_cast<const Row&>(row));
+        ++num_rows;
+      }
+      pos = newline + 1;
+    }
+    return num_rows;
+  }
+
+  /// Call fun(const Row&) for every row in the file.
+  template<typename FUN>
+  size_t ForEachRow(const emp::vector<size_t>& columns, FUN&& fun) const {
+    return ForEachRow(body, columns, std::forward<FUN>(fun));
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_CSV_READER_HPP_INCLUDE
@@ -0,0 +1,225 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_GENOME_LIBRARY_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_GENOME_LIBRARY_HPP_INCLUDE
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+#include "ByteBuffer.hpp"
+#include "MappedFile.hpp"
+
+namespace dirdevo {
+
+/// Genome library file format (native byte order, like ByteBuffer):
+///   magic (8 bytes, GENOME_LIBRARY_MAGIC)
+///   tag (length-prefixed string; what wrote the genomes, e.g., the experiment setup)
+///   genome size (uint64; the organism's fixed genome size, or 0 if its genomes vary in size)
+///   num_slices (uint64)
+///   slice index: for each slice, offset (uint64; from the start of the file), size in bytes (uint64), num genomes (uint64)
+///   slice data: each slice is its genomes back to back, each written with the organism's WriteGenome.
+/// A slice is typically one world's population (e.g., see OUTPUT_POPULATION_LIBRARY).
+/// Readers should check the tag and genome size before decoding genomes (genomes carry no type information).
+constexpr char GENOME_LIBRARY_MAGIC[8] = {'D','D','G','E','N','L','B','2'};
+
+/// Genome size recorded in libraries of ORG_T genomes: ORG_T::GENOME_SIZE, or 0 if ORG_T doesn't have a fixed size.
+template<typename ORG_T, typename=void>
+struct library_genome_size : std::integral_constant<uint64_t, 0> { };
+
+template<typename ORG_T>
+struct library_genome_size<ORG_T, std::void_t<decltype(ORG_T::GENOME_SIZE)>>
+  : std::integral_constant<uint64_t, ORG_T::GENOME_SIZE> { };
+
+/// Writes a genome library, one slice at a time (slices are streamed to the file as they're finished).
+template<typename ORG_T>
+class GenomeLibraryWriter {
+public:
+  using org_t = ORG_T;
+  using genome_t = typename org_t::genome_t;
+
+protected:
+  struct SliceEntry {
+    uint64_t offset=0;
+    uint64_t size=0;
+    uint64_t num_genomes=0;
+  };
+
+  std::ofstream file;
+  std::string tag;
+  emp::vector<SliceEntry> index;
+  std::string slice_buffer;     ///< Genomes in the current slice
+  size_t num_slices=0;          ///< Number of slices started so far
+  uint64_t file_pos=0;
+
+  size_t HeaderSize() const {
+    return sizeof(GENOME_LIBRARY_MAGIC) + (sizeof(uint64_t) + tag.size()) + sizeof(uint64_t) + sizeof(uint64_t)
+      + index.size() * sizeof(SliceEntry);
+  }
+
+  void FlushSlice() {
+    if (!num_slices) return;
+    SliceEntry& entry = index[num_slices - 1];
+    entry.offset = file_pos;
+    entry.size = slice_buffer.size();
+    file.write(slice_buffer.data(), (std::streamsize)slice_buffer.size());
+    file_pos += slice_buffer.size();
+    slice_buffer.clear();
+  }
+
+public:
+  /// Create a library with exactly total_slices slices at path (overwrites any existing file). The tag identifies what
+  /// kind of genomes the library holds (e.g., the experiment setup).
+  GenomeLibraryWriter(const std::string& path, size_t total_slices, const std::string& in_tag="")
+    : file(path, std::ios::binary | std::ios::trunc), tag(in_tag), index(total_slices)
+  {
+    // Reserve space for the header (written once every slice is done).
+    const std::string header(HeaderSize(), '\0');
+    file.write(header.data(), (std::streamsize)header.size());
+    file_pos = header.size();
+  }
+
+  ~GenomeLibraryWriter() { Close(); }
+
+  bool IsOpen() const { return file.is_open(); }
+
+  /// Finish the current slice (if any) and start the next one.
+  void StartSlice() {
+    emp_assert(num_slices < index.size(), "More slices than the library was created with.", num_slices, index.size());
+    FlushSlice();
+    ++num_slices;
+  }
+
+  /// Add a genome to the current slice.
+  void AddGenome(const genome_t& genome) {
+    emp_assert(num_slices, "StartSlice must be called before adding genomes.");
+    ByteWriter out(slice_buffer);
+    org_t::WriteGenome(genome, out);
+    ++index[num_slices - 1].num_genomes;
+  }
+
+  /// Finish the last slice and write the header. Returns whether everything was written successfully.
+  bool Close() {
+    if (!file.is_open()) return false;
+    emp_assert(num_slices == index.size(), "Library closed before every slice was written.", num_slices, index.size());
+    FlushSlice();
+    std::string header;
+    ByteWriter out(header);
+    for (char c : GENOME_LIBRARY_MAGIC) out.Write<char>(c);
+    out.WriteString(tag);
+    out.Write<uint64_t>(library_genome_size<org_t>::value);
+    out.Write<uint64_t>(index.size());
+    for (const SliceEntry& entry : index) {
+      out.Write<uint64_t>(entry.offset);
+      out.Write<uint64_t>(entry.size);
+      out.Write<uint64_t>(entry.num_genomes);
+    }
+    file.seekp(0);
+    file.write(header.data(), (std::streamsize)header.size());
+    const bool good = file.good();
+    file.close();
+    return good;
+  }
+};
+
+/// Read-only view of a genome library file. The file is memory-mapped, so opening a large library is cheap, only the
+/// slices that are read get paged in, and slices can be decoded concurrently from multiple threads.
+class GenomeLibrary {
+protected:
+  struct SliceEntry {
+    uint64_t offset=0;
+    uint64_t size=0;
+    uint64_t num_genomes=0;
+  };
+
+  MappedFile file;
+  std::string tag;
+  uint64_t genome_size=0;
+  emp::vector<SliceEntry> index;
+  std::string error;
+
+  bool Fail(const std::string& msg) {
+    Close();
+    error = msg;
+    return false;
+  }
+
+public:
+  GenomeLibrary() = default;
+  GenomeLibrary(const std::string& path) { Open(path); }
+
+  /// Map the library at path. On failure, returns false (see GetError for why).
+  bool Open(const std::string& path) {
+    Close();
+    error.clear();
+    if (!file.Open(path)) return Fail(file.GetError());
+    const size_t size = file.GetSize();
+    if (size < sizeof(GENOME_LIBRARY_MAGIC) + sizeof(uint64_t)) return Fail(path + ": not a genome library (too small)");
+
+    // Read and check the header
+    ByteReader in(file.GetData(), size);
+    for (char c : GENOME_LIBRARY_MAGIC) {
+      if (in.Read<char>() != c) return Fail(path + ": not a genome library (bad magic)");
+    }
+    const uint64_t tag_size = in.Read<uint64_t>();
+    if (tag_size > size - in.GetPos() || size - in.GetPos() - tag_size < 2 * sizeof(uint64_t)) {
+      return Fail(path + ": truncated header");
+    }
+    tag.assign(file.GetData() + in.GetPos(), tag_size);
+    in.Skip(tag_size);
+    genome_size = in.Read<uint64_t>();
+    const uint64_t num_slices = in.Read<uint64_t>();
+    if (num_slices > (size - in.GetPos()) / sizeof(SliceEntry)) return Fail(path + ": truncated slice index");
+    index.resize(num_slices);
+    for (SliceEntry& entry : index) {
+      entry.offset = in.Read<uint64_t>();
+      entry.size = in.Read<uint64_t>();
+      entry.num_genomes = in.Read<uint64_t>();
+      if (entry.offset > size || entry.size > size - entry.offset) return Fail(path + ": slice extends past end of file");
+    }
+    return true;
+  }
+
+  void Close() {
+    file.Close();
+    tag.clear();
+    genome_size = 0;
+    index.clear();
+  }
+
+  bool IsOpen() const { return file.IsOpen(); }
+  const std::string& GetError() const { return error; }
+
+  /// What kind of genomes does the library hold? (The tag it was written with, e.g., the experiment setup.)
+  const std::string& GetTag() const { return tag; }
+
+  /// Genome size the library was written with (see library_genome_size; 0 = genomes vary in size).
+  uint64_t GetGenomeSize() const { return genome_size; }
+
+  /// Does the library hold ORG_T genomes written with the given tag (i.e., can ORG_T's ReadGenome decode them)?
+  template<typename ORG_T>
+  bool Holds(const std::string& expected_tag) const {
+    return (tag == expected_tag) && (genome_size == library_genome_size<ORG_T>::value);
+  }
+
+  size_t GetNumSlices() const { return index.size(); }
+
+  /// How many genomes are in the given slice?
+  size_t GetNumGenomes(size_t slice) const {
+    emp_assert(slice < index.size(), slice, index.size());
+    return index[slice].num_genomes;
+  }
+
+  /// Reader over the given slice's genomes (read each with the organism's ReadGenome).
+  ByteReader GetSliceReader(size_t slice) const {
+    emp_assert(slice < index.size(), slice, index.size());
+    return ByteReader(file.GetData() + index[slice].offset, index[slice].size);
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_GENOME_LIBRARY_HPP_INCLUDE
@@ -0,0 +1,40 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_GENOTYPE_FINGERPRINT_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_GENOTYPE_FINGERPRINT_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ByteBuffer.hpp"
+
+namespace dirdevo {
+
+/// 64-bit stand-in for a full genome (e.g., as the taxon info in systematics tracking).
+using genotype_fingerprint_t = uint64_t;
+
+/// 64-bit FNV-1a hash of size bytes. Fixed by the algorithm (unlike std::hash), so fingerprints are the same across
+/// standard libraries, builds, and processes.
+inline uint64_t fnv1a_64(const char* data, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= (uint8_t)data[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/// Fingerprint a genome by hashing its serialized form (ORG_T::WriteGenome) with FNV-1a.
+/// Equal genomes always have equal fingerprints; unequal genomes rarely collide (FNV-1a isn't a cryptographic hash).
+template<typename ORG_T>
+genotype_fingerprint_t genotype_fingerprint(const typename ORG_T::genome_t& genome) {
+  thread_local std::string bytes; // Reused between calls (avoids an allocation per fingerprint)
+  bytes.clear();
+  ByteWriter writer(bytes);
+  ORG_T::WriteGenome(genome, writer);
+  return fnv1a_64(bytes.data(), bytes.size());
+}
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_GENOTYPE_FINGERPRINT_HPP_INCLUDE
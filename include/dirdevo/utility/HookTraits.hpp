@@ -0,0 +1,18 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_HOOK_TRAITS_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_HOOK_TRAITS_HPP_INCLUDE
+
+#include <type_traits>
+
+namespace dirdevo {
+
+/// Does a derived class define its own version of a (non-virtual) hook, or does it inherit its base class's default?
+/// Usage: overrides_hook_v<decltype(&DERIVED::Hook), decltype(&BASE::Hook)>
+/// If DERIVED does not declare Hook, &DERIVED::Hook names the base class's member (and has the same type).
+/// NOTE - hooks must not be overloaded (taking the address of an overloaded member function is ambiguous).
+template<typename DERIVED_HOOK_T, typename BASE_HOOK_T>
+constexpr bool overrides_hook_v = !std::is_same_v<DERIVED_HOOK_T, BASE_HOOK_T>;
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_HOOK_TRAITS_HPP_INCLUDE
@@ -0,0 +1,90 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_MAPPED_FILE_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_MAPPED_FILE_HPP_INCLUDE
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dirdevo {
+
+/// Read-only memory-mapped file. Only the pages that are touched get read from disk, and the contents can be read
+/// from multiple threads at once.
+class MappedFile {
+protected:
+  const char* data=nullptr;
+  size_t size=0;
+  bool is_open=false;
+  std::string error;
+
+  bool Fail(const std::string& msg) {
+    Close();
+    error = msg;
+    return false;
+  }
+
+public:
+  MappedFile() = default;
+  MappedFile(const std::string& path) { Open(path); }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() { Close(); }
+
+  /// Map the file at path. On failure, returns false (see GetError for why).
+  bool Open(const std::string& path) {
+    Close();
+    error.clear();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return Fail(path + ": " + std::strerror(errno));
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      const int stat_errno = errno;
+      ::close(fd);
+      return Fail(path + ": " + std::strerror(stat_errno));
+    }
+    size = (size_t)info.st_size;
+    if (size) {
+      void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      const int map_errno = errno;
+      ::close(fd); // The mapping stays valid after the file is closed.
+      if (mapped == MAP_FAILED) {
+        size = 0;
+        return Fail(path + ": " + std::strerror(map_errno));
+      }
+      data = static_cast<const char*>(mapped);
+    } else {
+      ::close(fd); // Can't map an empty file (but there's nothing to read anyway).
+    }
+    is_open = true;
+    return true;
+  }
+
+  void Close() {
+    if (data) ::munmap(const_cast<char*>(data), size);
+    data = nullptr;
+    size = 0;
+    is_open = false;
+  }
+
+  /// Hint that the file will be read front to back (more aggressive read-ahead).
+  void AdviseSequential() {
+    if (data) ::madvise(const_cast<char*>(data), size, MADV_SEQUENTIAL);
+  }
+
+  bool IsOpen() const { return is_open; }
+  const std::string& GetError() const { return error; }
+
+  const char* GetData() const { return data; }
+  size_t GetSize() const { return size; }
+  std::string_view GetView() const { return std::string_view(data, size); }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_MAPPED_FILE_HPP_INCLUDE
@@ -0,0 +1,76 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_PAIRWISE_DISTANCE_SAMPLER_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_PAIRWISE_DISTANCE_SAMPLER_HPP_INCLUDE
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+namespace dirdevo {
+
+/// Estimates the distribution of phylogenetic distances between active taxa from a fixed number of random pairs.
+/// Systematics::AddPairwiseDistanceDataNode measures every pair of active taxa (quadratic in the number of taxa);
+/// sampling bounds the cost of each measurement to num_samples ancestor walks.
+///
+/// Distance between two taxa = number of parent links between them (through their most recent common ancestor).
+/// Pairs of taxa that don't share a root are skipped.
+/// Has its own random number generator, so sampling doesn't perturb the experiment's random number stream.
+template<typename SYSTEMATICS_T>
+class PairwiseDistanceSampler {
+public:
+  using systematics_t = SYSTEMATICS_T;
+  using taxon_t = typename systematics_t::taxon_t;
+
+protected:
+  emp::Random random;
+  size_t num_samples;
+
+  emp::vector< emp::Ptr<taxon_t> > taxa;            ///< Used internally (active taxa, in a random-accessible form)
+  std::unordered_map<size_t, size_t> ancestor_steps;///< Used internally (taxon id => steps up from the first taxon of a pair)
+  emp::vector<double> distances;                    ///< Most recent sample
+
+public:
+  PairwiseDistanceSampler(int seed, size_t a_num_samples) : random(seed), num_samples(a_num_samples) { ; }
+
+  size_t GetNumSamples() const { return num_samples; }
+
+  /// Number of parent links between a and b (-1 if they don't share an ancestor).
+  int BranchDistance(emp::Ptr<taxon_t> a, emp::Ptr<taxon_t> b) {
+    ancestor_steps.clear();
+    size_t steps = 0;
+    for (emp::Ptr<taxon_t> taxon = a; taxon; taxon = taxon->GetParent()) {
+      ancestor_steps[taxon->GetID()] = steps++;
+    }
+    steps = 0;
+    for (emp::Ptr<taxon_t> taxon = b; taxon; taxon = taxon->GetParent()) {
+      const auto it = ancestor_steps.find(taxon->GetID());
+      if (it != ancestor_steps.end()) return (int)(it->second + steps);
+      ++steps;
+    }
+    return -1;
+  }
+
+  /// Sample distances between random pairs of (distinct) active taxa.
+  const emp::vector<double>& Sample(const systematics_t& systematics) {
+    distances.clear();
+    taxa.assign(systematics.GetActive().begin(), systematics.GetActive().end());
+    if (taxa.size() < 2) return distances;
+    // Active taxa are stored by pointer (iteration order varies between runs); sort them so samples are reproducible.
+    std::sort(taxa.begin(), taxa.end(), [](emp::Ptr<taxon_t> x, emp::Ptr<taxon_t> y) { return x->GetID() < y->GetID(); });
+    for (size_t i = 0; i < num_samples; ++i) {
+      const size_t a = random.GetUInt(taxa.size());
+      size_t b = random.GetUInt(taxa.size() - 1);
+      if (b >= a) ++b;
+      const int dist = BranchDistance(taxa[a], taxa[b]);
+      if (dist >= 0) distances.emplace_back((double)dist);
+    }
+    return distances;
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_PAIRWISE_DISTANCE_SAMPLER_HPP_INCLUDE
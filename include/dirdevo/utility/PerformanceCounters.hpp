@@ -0,0 +1,106 @@
+/**
+ * @file PerformanceCounters.hpp
+ * @brief Lightweight performance instrumentation (counters + phase timers).
+ *
+ * Instrumentation is only compiled in when DIRDEVO_INSTRUMENTATION is defined. Otherwise, anything wrapped
+ * in DIRDEVO_INSTRUMENT(...) is removed by the preprocessor (i.e., no cost on the hot path).
+ */
+
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_PERFORMANCE_COUNTERS_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_PERFORMANCE_COUNTERS_HPP_INCLUDE
+
+#include <algorithm>
+#include <chrono>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+#ifdef DIRDEVO_INSTRUMENTATION
+#define DIRDEVO_INSTRUMENT(...) __VA_ARGS__
+#else
+#define DIRDEVO_INSTRUMENT(...)
+#endif // DIRDEVO_INSTRUMENTATION
+
+namespace dirdevo {
+
+/// Counts of (hot path) events that happened in a single world.
+struct WorldPerfCounters {
+  size_t org_steps=0;         ///< Organism steps (i.e., calls to an organism's ProcessStep)
+  size_t births=0;            ///< Offspring placed into the world
+  size_t deaths=0;            ///< Organisms removed from the world (including organisms replaced by offspring)
+  size_t scheduler_draws=0;   ///< Calls to the scheduler to pick the next organism to run
+  double simulate_seconds=0;  ///< Wall time spent running world updates
+
+  void Reset() { *this = WorldPerfCounters(); }
+
+  /// Organism steps per second of simulation time (for instruction-based organisms, an organism step is an instruction)
+  double GetStepsPerSecond() const {
+    return (simulate_seconds > 0) ? (double)org_steps / simulate_seconds : 0.0;
+  }
+
+  WorldPerfCounters& operator+=(const WorldPerfCounters& other) {
+    org_steps += other.org_steps;
+    births += other.births;
+    deaths += other.deaths;
+    scheduler_draws += other.scheduler_draws;
+    simulate_seconds += other.simulate_seconds;
+    return *this;
+  }
+};
+
+/// Accumulates wall time across a fixed number of phases. At most one phase is timed at a time: starting a
+/// phase stops whichever phase was running.
+class PhaseTimer {
+public:
+  using clock_t = std::chrono::steady_clock;
+
+protected:
+  emp::vector<double> phase_seconds;
+  size_t cur_phase=0;
+  bool running=false;
+  clock_t::time_point phase_start;
+
+public:
+  PhaseTimer(size_t num_phases) : phase_seconds(num_phases, 0.0) { ; }
+
+  /// Stop timing the current phase (if any), start timing the given phase.
+  void Start(size_t phase) {
+    emp_assert(phase < phase_seconds.size(), phase, phase_seconds.size());
+    const auto now = clock_t::now();
+    if (running) phase_seconds[cur_phase] += std::chrono::duration<double>(now - phase_start).count();
+    cur_phase = phase;
+    phase_start = now;
+    running = true;
+  }
+
+  /// Stop timing the current phase.
+  void Stop() {
+    if (!running) return;
+    phase_seconds[cur_phase] += std::chrono::duration<double>(clock_t::now() - phase_start).count();
+    running = false;
+  }
+
+  /// Clear accumulated times.
+  void Reset() {
+    std::fill(phase_seconds.begin(), phase_seconds.end(), 0.0);
+    running = false;
+  }
+
+  double GetSeconds(size_t phase) const {
+    emp_assert(phase < phase_seconds.size(), phase, phase_seconds.size());
+    return phase_seconds[phase];
+  }
+
+  double GetTotalSeconds() const {
+    double total = 0.0;
+    for (double seconds : phase_seconds) total += seconds;
+    return total;
+  }
+
+  size_t GetNumPhases() const { return phase_seconds.size(); }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_PERFORMANCE_COUNTERS_HPP_INCLUDE
@@ -0,0 +1,73 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_PHILOX_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_PHILOX_HPP_INCLUDE
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+using philox_counter_t = std::array<uint32_t, 4>;
+using philox_key_t = std::array<uint32_t, 2>;
+
+/// Philox4x32-10 counter-based random number generator (Salmon et al. 2011, "Parallel random numbers: as easy as
+/// 1, 2, 3"). Maps a (counter, key) pair to 128 random bits; there is no state, so any block of any stream can be
+/// generated directly (no need to generate everything before it).
+inline philox_counter_t philox4x32_10(philox_counter_t ctr, philox_key_t key) {
+  constexpr uint32_t M0 = 0xD2511F53;
+  constexpr uint32_t M1 = 0xCD9E8D57;
+  constexpr uint32_t W0 = 0x9E3779B9;
+  constexpr uint32_t W1 = 0xBB67AE85;
+  for (size_t round = 0; round < 10; ++round) {
+    const uint64_t prod0 = (uint64_t)M0 * ctr[0];
+    const uint64_t prod1 = (uint64_t)M1 * ctr[2];
+    ctr = {
+      (uint32_t)(prod1 >> 32) ^ ctr[1] ^ key[0],
+      (uint32_t)prod1,
+      (uint32_t)(prod0 >> 32) ^ ctr[3] ^ key[1],
+      (uint32_t)prod0
+    };
+    key[0] += W0;
+    key[1] += W1;
+  }
+  return ctr;
+}
+
+/// Seed (for an emp::Random) of the random number stream identified by (stream_key, id, epoch, purpose).
+/// Streams don't depend on each other, so a stream's numbers are the same no matter which thread or process runs it,
+/// what order streams are run in, or which streams are run at all (e.g., resuming at a later epoch).
+/// Seeds are in [1, 2^31 - 1] (emp::Random seeds with the time when given a seed <= 0). draw picks which of the
+/// stream's candidate seeds to use (see unique_stream_seeds).
+inline int stream_seed(uint64_t stream_key, uint32_t id, uint32_t epoch, uint32_t purpose, uint32_t draw=0) {
+  const philox_counter_t bits = philox4x32_10(
+    {id, epoch, purpose, draw},
+    {(uint32_t)stream_key, (uint32_t)(stream_key >> 32)}
+  );
+  const uint64_t value = ((uint64_t)bits[0] << 32) | bits[1];
+  return (int)(value % 0x7FFFFFFF) + 1;
+}
+
+/// Seeds of the streams (stream_key, id, epoch, purpose) for every id in [0, num_ids), no two of which are the same.
+/// Seeds only have 31 bits, so with enough ids, two streams can land on the same seed (and two worlds would draw the
+/// same numbers); the later id then moves on to its stream's next candidate seed. The result depends only on num_ids
+/// (not on which ids a process runs), so every process computes the same seeds.
+inline emp::vector<int> unique_stream_seeds(uint64_t stream_key, uint32_t num_ids, uint32_t epoch, uint32_t purpose) {
+  emp::vector<int> seeds(num_ids);
+  std::unordered_set<int> used;
+  used.reserve(num_ids);
+  for (uint32_t id = 0; id < num_ids; ++id) {
+    uint32_t draw = 0;
+    do {
+      seeds[id] = stream_seed(stream_key, id, epoch, purpose, draw++);
+    } while (!used.insert(seeds[id]).second);
+  }
+  return seeds;
+}
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_PHILOX_HPP_INCLUDE
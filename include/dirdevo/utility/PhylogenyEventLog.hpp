@@ -0,0 +1,134 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_PHYLOGENY_EVENT_LOG_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_PHYLOGENY_EVENT_LOG_HPP_INCLUDE
+
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+/// Append-only log of phylogeny events (an alternative to repeatedly writing full phylogeny snapshots).
+///
+/// Each line of the log (CSV: event,id,parent_id,time) is one of:
+/// - new: taxon id was created (parent_id is -1 for roots; time = origination time)
+/// - extinct: taxon id lost its last living organism (time = destruction time)
+/// - prune: taxon id was removed from the phylogeny (extinct, with no living descendants)
+/// - epoch: end of epoch id (time = update); a snapshot at this point matches the phylogeny that
+///   Systematics::Snapshot would have written (see scripts/reconstruct_phylogeny.py)
+///
+/// Taxon fields (e.g., origination time) are read when events are written rather than when they are signaled, so
+/// events are queued and written before the next prune (pruned taxa are deleted) or epoch marker.
+/// WARNING - the log must be destroyed before the systematics manager it is attached to.
+template<typename SYSTEMATICS_T, typename ORG_T>
+class PhylogenyEventLog {
+public:
+  using systematics_t = SYSTEMATICS_T;
+  using taxon_t = typename systematics_t::taxon_t;
+  using org_t = ORG_T;
+
+protected:
+  enum class Event { NEW, EXTINCT };
+
+  struct PendingEvent {
+    Event event;
+    emp::Ptr<taxon_t> taxon;
+  };
+
+  std::ofstream file;
+  std::string buffer;                       ///< Resolved events that haven't been written to file yet
+  emp::vector<PendingEvent> pending;        ///< Events whose taxon fields haven't been read yet
+
+  std::function<void(emp::Ptr<taxon_t>, org_t&)> on_new;
+  std::function<void(emp::Ptr<taxon_t>)> on_extinct;
+  std::function<void(emp::Ptr<taxon_t>)> on_prune;
+
+  void AppendLine(const std::string& event, size_t id, const std::string& parent_id, const std::string& time) {
+    buffer += event;
+    buffer += ',';
+    buffer += std::to_string(id);
+    buffer += ',';
+    buffer += parent_id;
+    buffer += ',';
+    buffer += time;
+    buffer += '\n';
+  }
+
+  /// Resolve pending events (read their taxa) into the buffer.
+  void ResolvePending() {
+    for (const PendingEvent& event : pending) {
+      if (event.event == Event::NEW) {
+        const auto parent = event.taxon->GetParent();
+        AppendLine(
+          "new",
+          event.taxon->GetID(),
+          (parent) ? std::to_string(parent->GetID()) : "-1",
+          FormatTime(event.taxon->GetOriginationTime())
+        );
+      } else {
+        AppendLine("extinct", event.taxon->GetID(), "", FormatTime(event.taxon->GetDestructionTime()));
+      }
+    }
+    pending.clear();
+  }
+
+  static std::string FormatTime(double time) {
+    return std::to_string((long long)time);
+  }
+
+public:
+  PhylogenyEventLog() = default;
+  PhylogenyEventLog(const PhylogenyEventLog&) = delete;
+  PhylogenyEventLog& operator=(const PhylogenyEventLog&) = delete;
+
+  ~PhylogenyEventLog() { Flush(); }
+
+  /// Start listening to the given systematics manager's taxon events.
+  /// Events that happen before Open is called are kept until there's a file to write them to.
+  void Attach(systematics_t& systematics) {
+    on_new = [this](emp::Ptr<taxon_t> taxon, org_t&) {
+      pending.push_back({Event::NEW, taxon});
+    };
+    on_extinct = [this](emp::Ptr<taxon_t> taxon) {
+      pending.push_back({Event::EXTINCT, taxon});
+    };
+    on_prune = [this](emp::Ptr<taxon_t> taxon) {
+      ResolvePending(); // The taxon (and possibly pending events about it) are about to be deleted.
+      AppendLine("prune", taxon->GetID(), "", "");
+    };
+    systematics.OnNew(on_new);
+    systematics.OnExtinct(on_extinct);
+    systematics.OnPrune(on_prune);
+  }
+
+  /// Open the log file (writes the header, along with any events logged so far).
+  void Open(const std::string& filename) {
+    if (file.is_open()) file.close();
+    file.open(filename);
+    file << "event,id,parent_id,time\n";
+    Flush();
+  }
+
+  /// Mark the end of an epoch (at the given update) and flush everything to file.
+  void MarkEpoch(size_t epoch, size_t update) {
+    ResolvePending();
+    AppendLine("epoch", epoch, "", std::to_string(update));
+    Flush();
+  }
+
+  /// Write out everything that has been logged so far (if the log file is open).
+  void Flush() {
+    ResolvePending();
+    if (!file.is_open()) return;
+    file << buffer;
+    file.flush();
+    buffer.clear();
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_PHYLOGENY_EVENT_LOG_HPP_INCLUDE
@@ -0,0 +1,213 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_POPULATION_STORE_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_POPULATION_STORE_HPP_INCLUDE
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+namespace dirdevo {
+
+/// Fixed-size population of organisms (one per cell), built for DirectedDevoWorld.
+///
+/// - Organisms live in a contiguous slab of cells (organisms never move unless explicitly swapped, and references to
+///   organisms stay valid until that organism is removed or the store is reconfigured).
+/// - Occupancy is tracked in a bitmap; occupied and empty cells are also kept partitioned in a cell list (occupied
+///   cells first, then the free list), so counting, random occupied/empty cell draws, and iterating over organisms
+///   are all cheap.
+/// - Spatial structure is a precomputed neighbor table (one row of neighbors per cell), so picking a random neighbor is
+///   one random draw plus one table load (no per-birth coordinate/modulo arithmetic). Tables are only rebuilt when the
+///   structure's shape changes. A well-mixed population has no table (any cell is a neighbor of any other).
+template<typename ORG>
+class PopulationStore {
+public:
+  using org_t = ORG;
+
+protected:
+  emp::vector< std::optional<org_t> > slots;  ///< One slot per cell
+  emp::vector<uint64_t> occupied_bits;        ///< Bit i is set if cell i is occupied
+  emp::vector<size_t> cells;                  ///< Cells: [0, num_orgs) are occupied, [num_orgs, size) are empty
+  emp::vector<size_t> cell_index;             ///< Position of each cell in cells
+  size_t num_orgs=0;
+
+  size_t neighborhood_size=0;                 ///< Neighbors per cell (0 = well mixed)
+  emp::vector<uint32_t> neighbors;            ///< neighbors[cell * neighborhood_size + i] = i'th neighbor of cell
+  size_t grid_width=0;                        ///< Shape of the current neighbor table
+  size_t grid_height=0;
+  size_t grid_depth=0;
+
+  /// Clear the population and resize it to the given number of cells.
+  void Resize(size_t size) {
+    slots.clear();
+    slots.resize(size);
+    occupied_bits.assign((size + 63) / 64, 0);
+    cells.resize(size);
+    cell_index.resize(size);
+    for (size_t cell = 0; cell < size; ++cell) {
+      cells[cell] = cell;
+      cell_index[cell] = cell;
+    }
+    num_orgs = 0;
+  }
+
+  /// Move a cell to the given position in the cell list (swapping it with whatever cell was there).
+  void MoveCellTo(size_t cell, size_t index) {
+    const size_t other_cell = cells[index];
+    const size_t cur_index = cell_index[cell];
+    cells[index] = cell;
+    cells[cur_index] = other_cell;
+    cell_index[cell] = index;
+    cell_index[other_cell] = cur_index;
+  }
+
+public:
+
+  /// Configure a well-mixed population with the given number of cells (clears the population).
+  void SetMixed(size_t size) {
+    Resize(size);
+    neighborhood_size = 0;
+    neighbors.clear();
+    grid_width = grid_height = grid_depth = 0;
+  }
+
+  /// Configure a toroidal 2D grid (clears the population).
+  /// Neighborhoods are the 9 cells (including itself) surrounding each cell.
+  void SetGrid(size_t width, size_t height) {
+    const size_t size = width * height;
+    emp_assert(size <= UINT32_MAX, size);
+    Resize(size);
+    if (neighborhood_size == 9 && grid_width == width && grid_height == height) return; // Table is already built.
+    neighborhood_size = 9;
+    grid_width = width;
+    grid_height = height;
+    grid_depth = 1;
+    neighbors.resize(size * neighborhood_size);
+    for (size_t cell = 0; cell < size; ++cell) {
+      const size_t x = cell % width;
+      const size_t y = cell / width;
+      for (size_t offset = 0; offset < neighborhood_size; ++offset) {
+        const size_t nx = (x + width + offset % 3 - 1) % width;
+        const size_t ny = (y + height + offset / 3 - 1) % height;
+        neighbors[cell * neighborhood_size + offset] = (uint32_t)(nx + ny * width);
+      }
+    }
+  }
+
+  /// Configure a toroidal 3D grid (clears the population).
+  /// Neighborhoods are the 27 cells (including itself) surrounding each cell.
+  void SetGrid3D(size_t width, size_t height, size_t depth) {
+    const size_t size = width * height * depth;
+    emp_assert(size <= UINT32_MAX, size);
+    Resize(size);
+    if (neighborhood_size == 27 && grid_width == width && grid_height == height && grid_depth == depth) return;
+    neighborhood_size = 27;
+    grid_width = width;
+    grid_height = height;
+    grid_depth = depth;
+    neighbors.resize(size * neighborhood_size);
+    for (size_t cell = 0; cell < size; ++cell) {
+      const size_t x = cell % width;
+      const size_t y = (cell / width) % height;
+      const size_t z = cell / (width * height);
+      for (size_t offset = 0; offset < neighborhood_size; ++offset) {
+        const size_t nx = (x + width + offset % 3 - 1) % width;
+        const size_t ny = (y + height + (offset / 3) % 3 - 1) % height;
+        const size_t nz = (z + depth + offset / 9 - 1) % depth;
+        neighbors[cell * neighborhood_size + offset] = (uint32_t)(nx + ny * width + nz * width * height);
+      }
+    }
+  }
+
+  size_t GetSize() const { return slots.size(); }
+  size_t GetNumOrgs() const { return num_orgs; }
+  size_t GetNeighborhoodSize() const { return neighborhood_size; }
+
+  bool IsOccupied(size_t cell) const {
+    emp_assert(cell < GetSize(), cell, GetSize());
+    return (occupied_bits[cell / 64] >> (cell % 64)) & 1;
+  }
+
+  org_t& GetOrg(size_t cell) {
+    emp_assert(IsOccupied(cell), cell);
+    return *slots[cell];
+  }
+
+  const org_t& GetOrg(size_t cell) const {
+    emp_assert(IsOccupied(cell), cell);
+    return *slots[cell];
+  }
+
+  /// Get the i'th occupied cell (0 <= i < GetNumOrgs(); order changes as organisms are added and removed).
+  size_t GetOccupiedCell(size_t i) const {
+    emp_assert(i < num_orgs, i, num_orgs);
+    return cells[i];
+  }
+
+  /// Move an organism into an empty cell.
+  org_t& Place(size_t cell, org_t&& org) {
+    emp_assert(!IsOccupied(cell), cell);
+    slots[cell].emplace(std::move(org));
+    occupied_bits[cell / 64] |= (uint64_t)1 << (cell % 64);
+    MoveCellTo(cell, num_orgs);
+    ++num_orgs;
+    return *slots[cell];
+  }
+
+  /// Destroy the organism in the given (occupied) cell.
+  void Remove(size_t cell) {
+    emp_assert(IsOccupied(cell), cell);
+    slots[cell].reset();
+    occupied_bits[cell / 64] &= ~((uint64_t)1 << (cell % 64));
+    --num_orgs;
+    MoveCellTo(cell, num_orgs);
+  }
+
+  /// Swap the contents (organisms or emptiness) of two cells.
+  void Swap(size_t cell1, size_t cell2) {
+    const bool occupied1 = IsOccupied(cell1);
+    const bool occupied2 = IsOccupied(cell2);
+    std::swap(slots[cell1], slots[cell2]);
+    if (occupied1 == occupied2) return;
+    // Exactly one cell is occupied: swap their positions in the cell list and flip both occupancy bits.
+    MoveCellTo(cell1, cell_index[cell2]);
+    occupied_bits[cell1 / 64] ^= (uint64_t)1 << (cell1 % 64);
+    occupied_bits[cell2 / 64] ^= (uint64_t)1 << (cell2 % 64);
+  }
+
+  /// Destroy all organisms.
+  void Clear() {
+    while (num_orgs) Remove(cells[num_orgs - 1]);
+  }
+
+  /// Pick a random neighbor of the given cell (any cell in a well-mixed population).
+  size_t GetRandomNeighbor(size_t cell, emp::Random& random) const {
+    if (!neighborhood_size) return random.GetUInt(GetSize());
+    return neighbors[cell * neighborhood_size + random.GetUInt(neighborhood_size)];
+  }
+
+  /// Get the i'th neighbor of the given cell (grid structures only).
+  size_t GetNeighbor(size_t cell, size_t i) const {
+    emp_assert(i < neighborhood_size, i, neighborhood_size);
+    return neighbors[cell * neighborhood_size + i];
+  }
+
+  /// Pick a random occupied cell (there must be at least one organism).
+  size_t GetRandomOrgID(emp::Random& random) const {
+    emp_assert(num_orgs > 0);
+    return cells[random.GetUInt(num_orgs)];
+  }
+
+  /// Pick a random empty cell (there must be at least one empty cell).
+  size_t GetRandomEmptyCellID(emp::Random& random) const {
+    emp_assert(num_orgs < GetSize());
+    return cells[num_orgs + random.GetUInt(GetSize() - num_orgs)];
+  }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_POPULATION_STORE_HPP_INCLUDE
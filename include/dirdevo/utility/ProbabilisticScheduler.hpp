@@ -9,7 +9,8 @@
 #include <algorithm>
 #include <numeric>
 
-#include "emp/datastructs/IndexMap.hpp"
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
 #include "emp/math/Random.hpp"
 
 namespace dirdevo {
@@ -21,6 +22,11 @@ namespace dirdevo {
  *  - (1) The ProbabilisticScheduler will maintain a schedule (of a configured size), and you can use UpdateSchedule calls to update this maintained schedule based on current item weights.
  *    This approach allows you to repeatedly compute chunks of a schedule without constantly creating new vectors.
  *  - (2) Alternatively, just call GetRandom repeatedly each time you need choose something to 'run'.
+ *
+ * Weights are kept in a flat sum tree (leaves are item weights; each internal node is the sum of its children).
+ * Single adjustments update their path to the root. Deferred adjustments only mark a dirty range of leaves, and the
+ * next draw rebuilds just the part of the tree above that range, so a bulk update touching k adjacent items costs
+ * O(k + log n) rather than O(n). LoadWeights replaces every weight at once (one O(n) rebuild).
  */
 class ProbabilisticScheduler {
 public:
@@ -32,7 +38,69 @@ protected:
   size_t num_items;
 
   schedule_t schedule;
-  emp::IndexMap weight_map;
+
+  size_t num_leaves=1;          ///< Leaf count (power of 2, >= num_items)
+  emp::vector<double> tree;     ///< tree[1] = total weight; node n has children 2n and 2n+1; leaf i is tree[num_leaves+i]
+  bool defer_refresh=false;     ///< Are adjustments being batched (until the next refresh)?
+  size_t dirty_begin=0;         ///< Leaves [dirty_begin, dirty_end) have changed since their ancestors were last summed
+  size_t dirty_end=0;
+
+  /// Clear all weights (and resize the tree to fit num_items).
+  void ResetTree() {
+    num_leaves = 1;
+    while (num_leaves < num_items) num_leaves <<= 1;
+    tree.assign(2 * num_leaves, 0.0);
+    defer_refresh = false;
+    dirty_begin = dirty_end = 0;
+  }
+
+  void MarkDirty(size_t item_id) {
+    if (dirty_begin == dirty_end) {
+      dirty_begin = item_id;
+      dirty_end = item_id + 1;
+    } else {
+      dirty_begin = std::min(dirty_begin, item_id);
+      dirty_end = std::max(dirty_end, item_id + 1);
+    }
+  }
+
+  /// Re-sum every node above the dirty range of leaves.
+  void Refresh() {
+    defer_refresh = false;
+    if (dirty_begin == dirty_end) return;
+    size_t lo = (num_leaves + dirty_begin) >> 1;
+    size_t hi = (num_leaves + dirty_end - 1) >> 1;
+    while (lo) {
+      for (size_t node = lo; node <= hi; ++node) tree[node] = tree[2 * node] + tree[2 * node + 1];
+      lo >>= 1;
+      hi >>= 1;
+    }
+    dirty_begin = dirty_end = 0;
+  }
+
+  /// Re-sum the path from a (just changed) leaf to the root.
+  void RefreshPath(size_t item_id) {
+    for (size_t node = (num_leaves + item_id) >> 1; node; node >>= 1) {
+      tree[node] = tree[2 * node] + tree[2 * node + 1];
+    }
+  }
+
+  /// Find the item whose cumulative weight range contains pos (0 <= pos < total weight).
+  size_t Index(double pos) const {
+    size_t node = 1;
+    while (node < num_leaves) {
+      const double left = tree[2 * node];
+      // Rounding can push pos past the total; never descend into an empty subtree because of it.
+      if (pos < left || tree[2 * node + 1] <= 0) {
+        node = 2 * node;
+      } else {
+        pos -= left;
+        node = 2 * node + 1;
+      }
+    }
+    emp_assert(node - num_leaves < num_items, node - num_leaves, num_items);
+    return node - num_leaves;
+  }
 
 public:
   ProbabilisticScheduler(
@@ -42,8 +110,7 @@ public:
   ) :
     random(rnd),
     num_items(n_items),
-    schedule(schedule_size),
-    weight_map(num_items)
+    schedule(schedule_size)
   {
     size_t i=0;
     std::generate(
@@ -51,27 +118,41 @@ public:
       schedule.end(),
       [this, &i] () mutable { return (i++)%num_items; }
     );
+    ResetTree();
   }
 
   size_t GetScheduleSize() const { return schedule.size(); }
   size_t GetNumItems() const { return num_items; }
   const schedule_t & GetCurSchedule() const { return schedule; }
-  const emp::IndexMap & GetWeightMap() const { return weight_map; }
 
-  /// Return a random index where probabilities are weighted according to the weight map.
+  /// Total weight of all items.
+  double GetWeight() {
+    Refresh();
+    return tree[1];
+  }
+
+  /// Weight of a single item.
+  double GetWeight(size_t item_id) const {
+    emp_assert(item_id < num_items, item_id, num_items);
+    return tree[num_leaves + item_id];
+  }
+
+  /// Return a random index where probabilities are weighted according to the item weights.
   size_t GetRandom() {
-    const double total_weight = weight_map.GetWeight();
-    return weight_map.Index(random.GetDouble() * total_weight);
+    Refresh();
+    emp_assert(tree[1] > 0);
+    return Index(random.GetDouble() * tree[1]);
   }
 
   /// Update the schedule according to the current weight settings
   const schedule_t & UpdateSchedule() {
-    const double total_weight = weight_map.GetWeight();
+    Refresh();
+    const double total_weight = tree[1];
     emp_assert(total_weight > 0);
     std::generate(
       schedule.begin(),
       schedule.end(),
-      [this, &total_weight] () { return weight_map.Index(random.GetDouble() * total_weight); }
+      [this, &total_weight] () { return Index(random.GetDouble() * total_weight); }
     );
     return schedule;
   }
@@ -83,14 +164,59 @@ public:
     return UpdateSchedule();
   }
 
-  /// Adjust the an item's weight in the weight map
+  /// Adjust the an item's weight
   void AdjustWeight(size_t item_id, double new_weight) {
-    weight_map.Adjust(item_id, new_weight);
+    emp_assert(item_id < num_items, item_id, num_items);
+    emp_assert(new_weight >= 0, new_weight);
+    tree[num_leaves + item_id] = new_weight;
+    if (defer_refresh || dirty_begin != dirty_end) {
+      MarkDirty(item_id);
+    } else {
+      RefreshPath(item_id);
+    }
   }
 
-  /// Give access to defer referesh on weight map
+  /// Swap two items' weights.
+  void SwapWeights(size_t item1, size_t item2) {
+    emp_assert(item1 < num_items && item2 < num_items, item1, item2, num_items);
+    double& weight1 = tree[num_leaves + item1];
+    double& weight2 = tree[num_leaves + item2];
+    if (weight1 == weight2) return;
+    std::swap(weight1, weight2);
+    if (defer_refresh || dirty_begin != dirty_end) {
+      MarkDirty(item1);
+      MarkDirty(item2);
+    } else {
+      RefreshPath(item1);
+      RefreshPath(item2);
+    }
+  }
+
+  /// Replace all item weights at once (weights must hold one weight per item).
+  void LoadWeights(const double* weights, size_t count) {
+    emp_assert(count == num_items, count, num_items);
+    std::copy(weights, weights + count, tree.begin() + (std::ptrdiff_t)num_leaves);
+    if (!count) return;
+    defer_refresh = false;
+    dirty_begin = 0;
+    dirty_end = count;
+    Refresh();
+  }
+
+  void LoadWeights(const emp::vector<double>& weights) {
+    LoadWeights(weights.data(), weights.size());
+  }
+
+  /// Defer refreshing the weight tree until the next draw (batch several adjustments together).
   void DeferWeightRefresh() {
-    weight_map.DeferRefresh();
+    defer_refresh = true;
+  }
+
+  /// Set every item's weight to zero (free if every weight is already zero).
+  void ClearWeights() {
+    Refresh();
+    if (tree[1] == 0) return; // Weights are non-negative, so a zero total means every leaf is zero.
+    std::fill(tree.begin(), tree.end(), 0.0);
   }
 
   /// Hard reset on the scheduler
@@ -103,7 +229,7 @@ public:
       schedule.end(),
       [this, &i] () mutable { return (i++)%num_items; }
     );
-    weight_map.ResizeClear(num_items);
+    ResetTree();
   }
 
   /// Hard reset on the scheduler
@@ -0,0 +1,83 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_SCORE_MATRIX_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_SCORE_MATRIX_HPP_INCLUDE
+
+#include <algorithm>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+/// Flat, contiguous (row-major) table of scores: one row per candidate, one column per objective.
+/// Unlike a vector of vectors, rows are adjacent in memory (and resizing to the same shape does not reallocate).
+class ScoreMatrix {
+protected:
+  size_t num_rows=0;
+  size_t num_cols=0;
+  emp::vector<double> data;
+
+public:
+  ScoreMatrix(size_t rows=0, size_t cols=0, double init=0.0) :
+    num_rows(rows),
+    num_cols(cols),
+    data(rows*cols, init)
+  { ; }
+
+  /// Build a score matrix from a table of score vectors (each row must be the same size).
+  explicit ScoreMatrix(const emp::vector< emp::vector<double> >& table) :
+    num_rows(table.size()),
+    num_cols(table.size() ? table[0].size() : 0),
+    data(num_rows*num_cols)
+  {
+    for (size_t row = 0; row < num_rows; ++row) {
+      emp_assert(table[row].size() == num_cols, row, table[row].size(), num_cols);
+      std::copy(table[row].begin(), table[row].end(), GetRow(row));
+    }
+  }
+
+  size_t GetNumRows() const { return num_rows; }
+  size_t GetNumCols() const { return num_cols; }
+
+  /// Change the shape of the matrix (existing values are not preserved in any meaningful layout).
+  void Resize(size_t rows, size_t cols) {
+    num_rows = rows;
+    num_cols = cols;
+    data.resize(rows*cols);
+  }
+
+  void Fill(double value) { std::fill(data.begin(), data.end(), value); }
+
+  double* GetRow(size_t row) {
+    emp_assert(row < num_rows, row, num_rows);
+    return data.data() + row*num_cols;
+  }
+
+  const double* GetRow(size_t row) const {
+    emp_assert(row < num_rows, row, num_rows);
+    return data.data() + row*num_cols;
+  }
+
+  double& operator()(size_t row, size_t col) {
+    emp_assert(row < num_rows && col < num_cols, row, col, num_rows, num_cols);
+    return data[row*num_cols + col];
+  }
+
+  double operator()(size_t row, size_t col) const {
+    emp_assert(row < num_rows && col < num_cols, row, col, num_rows, num_cols);
+    return data[row*num_cols + col];
+  }
+
+  /// Copy a row from another matrix (with the same number of columns).
+  void CopyRow(size_t row, const ScoreMatrix& other, size_t other_row) {
+    emp_assert(num_cols == other.num_cols, num_cols, other.num_cols);
+    std::copy(other.GetRow(other_row), other.GetRow(other_row) + num_cols, GetRow(row));
+  }
+
+  emp::vector<double>& GetData() { return data; }
+  const emp::vector<double>& GetData() const { return data; }
+};
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_SCORE_MATRIX_HPP_INCLUDE
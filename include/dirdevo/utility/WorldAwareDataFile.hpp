@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "emp/data/DataFile.hpp"
 
 namespace dirdevo {
@@ -30,6 +32,12 @@ public:
     return *cur_world;
   }
 
+  /// Write already-formatted rows straight to the file (e.g., rows buffered by another data file with these columns).
+  void WriteRows(const std::string& rows) {
+    *os << rows;
+    os->flush();
+  }
+
 };
 
 }
\ No newline at end of file
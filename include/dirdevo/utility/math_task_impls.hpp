@@ -15,13 +15,13 @@ namespace MATH_1IN {
  */
 
 // 1AA: 2*A
-double AA(double a) { return 2*a; }
+inline double AA(double a) { return 2*a; }
 
 // 1AB: A**2
-double AB(double a) { return a*a; }
+inline double AB(double a) { return a*a; }
 
 // 1AC: A**3
-double AC(double a) { return a*a*a; }
+inline double AC(double a) { return a*a*a; }
 
 }
 
@@ -40,21 +40,21 @@ namespace MATH_2IN {
  */
 
 // AA: A+B
-double AA(double a, double b) { return a+b; }
+inline double AA(double a, double b) { return a+b; }
 // AB: A*B
-double AB(double a, double b) { return a*b; }
+inline double AB(double a, double b) { return a*b; }
 // AC: A-B
-double AC(double a, double b) { return a-b; }
+inline double AC(double a, double b) { return a-b; }
 // AD: (A**2)+(B**2)
-double AD(double a, double b) { return (a*a)+(b*b); }
+inline double AD(double a, double b) { return (a*a)+(b*b); }
 // AE: (A**3)+(B**3)
-double AE(double a, double b) { return emp::Pow(a,3)+emp::Pow(b,3); }
+inline double AE(double a, double b) { return emp::Pow(a,3)+emp::Pow(b,3); }
 // AF: (A**2)-(B**2)
-double AF(double a, double b) { return emp::Pow(a,2)-emp::Pow(b,2); }
+inline double AF(double a, double b) { return emp::Pow(a,2)-emp::Pow(b,2); }
 // AG: (A**3)-(B**3)
-double AG(double a, double b) { return emp::Pow(a,3)-emp::Pow(b,3); }
+inline double AG(double a, double b) { return emp::Pow(a,3)-emp::Pow(b,3); }
 // AH: (A+B)/2
-double AH(double a, double b) { return (a+b)/2.0; }
+inline double AH(double a, double b) { return (a+b)/2.0; }
 
 
 }
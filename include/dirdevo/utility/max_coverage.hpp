@@ -0,0 +1,189 @@
+#pragma once
+#ifndef DIRECTED_DEVO_UTILITY_MAX_COVERAGE_HPP_INCLUDE
+#define DIRECTED_DEVO_UTILITY_MAX_COVERAGE_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+
+#include "emp/base/assert.hpp"
+#include "emp/base/vector.hpp"
+
+namespace dirdevo {
+
+// Maximum coverage: for each n, which n populations (task coverage profiles) together cover the most tasks?
+// Profiles are task coverage masks (one bit per task), so search state is just a mask and the number of picks left.
+// Before searching, profiles that are duplicates or whose coverage is a subset of another profile's coverage are
+// dropped: any solution using them does at least as well with the profile that dominates them (or with one fewer).
+
+using task_mask_t = uint64_t;
+constexpr size_t MAX_COVERAGE_TASKS = 64; ///< Most tasks a coverage mask can hold
+
+inline size_t count_tasks(task_mask_t mask) { return (size_t)__builtin_popcountll(mask); }
+
+/// Coverage mask as a string of 0s and 1s (task 0 first).
+inline std::string coverage_to_string(task_mask_t mask, size_t num_tasks) {
+  emp_assert(num_tasks <= MAX_COVERAGE_TASKS, num_tasks);
+  std::string str(num_tasks, '0');
+  for (size_t task_i = 0; task_i < num_tasks; ++task_i) {
+    if (mask & ((task_mask_t)1 << task_i)) str[task_i] = '1';
+  }
+  return str;
+}
+
+/// Depth-first branch-and-bound search for the most tasks that can be covered by at most N candidate profiles.
+class MaxCoverageSearch {
+protected:
+  const emp::vector<task_mask_t>& candidates;   ///< Candidate profiles (most tasks first)
+  emp::vector<task_mask_t> suffix_union;        ///< suffix_union[i] = union of candidates[i:]
+  size_t max_coverage=0;                        ///< Tasks covered by all candidates together
+
+  emp::vector<size_t> picks;                    ///< Candidates included on the current branch
+  emp::vector<size_t> gains;                    ///< Scratch space for bounds
+
+  size_t best_coverage=0;
+  task_mask_t best_mask=0;
+  emp::vector<size_t> best_picks;
+
+  /// Upper bound on what picks_left more candidates (from next on) can add to covered: the sum of the picks_left
+  /// largest individual gains (gains can overlap, so this never underestimates).
+  size_t GainBound(size_t next, task_mask_t covered, size_t picks_left) {
+    gains.clear();
+    for (size_t i = next; i < candidates.size(); ++i) {
+      const size_t gain = count_tasks(candidates[i] & ~covered);
+      if (gain) gains.emplace_back(gain);
+    }
+    if (gains.size() > picks_left) {
+      std::nth_element(gains.begin(), gains.begin() + picks_left, gains.end(), std::greater<size_t>());
+      gains.resize(picks_left);
+    }
+    size_t bound = 0;
+    for (size_t gain : gains) bound += gain;
+    return bound;
+  }
+
+  void Search(size_t next, task_mask_t covered, size_t picks_left) {
+    const size_t coverage = count_tasks(covered);
+    if (coverage > best_coverage) {
+      best_coverage = coverage;
+      best_mask = covered;
+      best_picks = picks;
+    }
+    if (best_coverage == max_coverage) return; // Can't do any better.
+    if (!picks_left || next >= candidates.size()) return;
+    // Bound: would everything that's left (or the best possible gains) beat the best so far?
+    if (count_tasks(covered | suffix_union[next]) <= best_coverage) return;
+    if (coverage + GainBound(next, covered, picks_left) <= best_coverage) return;
+    // Include next (only if it adds anything; otherwise, the exclude branch covers the same ground).
+    if (candidates[next] & ~covered) {
+      picks.emplace_back(next);
+      Search(next + 1, covered | candidates[next], picks_left - 1);
+      picks.pop_back();
+    }
+    // Exclude next
+    Search(next + 1, covered, picks_left);
+  }
+
+public:
+  MaxCoverageSearch(const emp::vector<task_mask_t>& in_candidates) :
+    candidates(in_candidates),
+    suffix_union(in_candidates.size() + 1, 0)
+  {
+    for (size_t i = candidates.size(); i-- > 0;) {
+      suffix_union[i] = suffix_union[i + 1] | candidates[i];
+    }
+    max_coverage = count_tasks(suffix_union[0]);
+  }
+
+  /// Find the best coverage using at most N candidates, starting from a known solution (a lower bound).
+  void Solve(size_t N, const emp::vector<size_t>& start_picks) {
+    best_picks = start_picks;
+    best_mask = 0;
+    for (size_t i : start_picks) best_mask |= candidates[i];
+    best_coverage = count_tasks(best_mask);
+    picks.clear();
+    Search(0, 0, N);
+  }
+
+  size_t GetBestCoverage() const { return best_coverage; }
+  task_mask_t GetBestMask() const { return best_mask; }
+  const emp::vector<size_t>& GetBestPicks() const { return best_picks; }
+};
+
+/// Best coverage found using (at most) num_profiles profiles.
+struct MaxCoverageSolution {
+  size_t num_profiles=0;
+  task_mask_t covered=0;            ///< Tasks covered by the chosen profiles
+  emp::vector<size_t> profiles;     ///< Which profiles were chosen (may be fewer than num_profiles)
+
+  size_t GetCoverage() const { return count_tasks(covered); }
+};
+
+/// Solve maximum coverage for every n from 1 to profiles.size(): solutions[n-1] is the most tasks that any n profiles
+/// cover together (and which profiles cover them).
+inline emp::vector<MaxCoverageSolution> solve_max_coverage(const emp::vector<task_mask_t>& profiles) {
+  emp::vector<MaxCoverageSolution> solutions(profiles.size());
+  if (profiles.empty()) return solutions;
+
+  // Candidates: one profile per distinct coverage, dropping any profile that's a strict subset of another.
+  emp::vector<size_t> order(profiles.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&profiles](size_t a, size_t b) {
+    return count_tasks(profiles[a]) > count_tasks(profiles[b]);
+  });
+  emp::vector<task_mask_t> candidates;     // Most tasks first
+  emp::vector<size_t> candidate_profiles;  // Profile index of each candidate
+  task_mask_t max_possible_mask = 0;
+  for (size_t profile_i : order) {
+    const task_mask_t mask = profiles[profile_i];
+    max_possible_mask |= mask;
+    // Anything that could contain this profile has at least as many tasks, so it's already a candidate.
+    const bool dominated = std::any_of(candidates.begin(), candidates.end(), [mask](task_mask_t other) {
+      return (mask & other) == mask;
+    });
+    if (dominated) continue;
+    candidates.emplace_back(mask);
+    candidate_profiles.emplace_back(profile_i);
+  }
+  const size_t max_possible_coverage = count_tasks(max_possible_mask);
+
+  MaxCoverageSearch search(candidates);
+  emp::vector<size_t> prev_picks;  // Best picks (candidate ids) for the previous n
+  task_mask_t prev_mask = 0;
+  for (size_t sol_i = 0; sol_i < solutions.size(); ++sol_i) {
+    MaxCoverageSolution& sol = solutions[sol_i];
+    sol.num_profiles = sol_i + 1;
+    if (!candidates.empty() && count_tasks(prev_mask) < max_possible_coverage) {
+      // Lower bound: previous solution plus whichever candidate adds the most.
+      size_t add_i = 0;
+      size_t add_cov = 0;
+      for (size_t cand_i = 0; cand_i < candidates.size(); ++cand_i) {
+        const size_t cov = count_tasks(prev_mask | candidates[cand_i]);
+        if (cov > add_cov) {
+          add_cov = cov;
+          add_i = cand_i;
+        }
+      }
+      emp::vector<size_t> start_picks(prev_picks);
+      start_picks.emplace_back(add_i);
+      if (add_cov < max_possible_coverage) {
+        search.Solve(sol.num_profiles, start_picks);
+        prev_picks = search.GetBestPicks();
+      } else {
+        prev_picks = start_picks;
+      }
+      prev_mask = 0;
+      for (size_t cand_i : prev_picks) prev_mask |= candidates[cand_i];
+    }
+    // Otherwise, more profiles can't cover any more tasks: reuse the previous solution.
+    sol.covered = prev_mask;
+    for (size_t cand_i : prev_picks) sol.profiles.emplace_back(candidate_profiles[cand_i]);
+  }
+  return solutions;
+}
+
+} // namespace dirdevo
+
+#endif // #ifndef DIRECTED_DEVO_UTILITY_MAX_COVERAGE_HPP_INCLUDE
@@ -1,7 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#if defined(DIRDEVO_PARETO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "emp/base/vector.hpp"
 
+#include "ScoreMatrix.hpp"
+
 namespace dirdevo {
 
   /// Does a dominate b?
@@ -18,8 +29,29 @@ namespace dirdevo {
     return !equal; // if a and b are not equal, a must dominate b (if b were ever greater than a, we would have returned false already)
   }
 
-    /// Each vector<double> in score table represents a single candidate's scores on a set of goals/objectives
-  emp::vector<size_t> find_pareto_front(const emp::vector< emp::vector<double> >& score_table) {
+  /// Does row a dominate row b? (a and b each point to num_objs scores)
+  /// Compile with DIRDEVO_PARETO_SIMD to compare two objectives at a time (requires SSE2).
+  inline bool dominates_row(const double* a, const double* b, size_t num_objs) {
+    bool greater = false;
+    size_t i = 0;
+    #if defined(DIRDEVO_PARETO_SIMD) && defined(__SSE2__)
+    for (; i + 2 <= num_objs; i += 2) {
+      const __m128d a_vals = _mm_loadu_pd(a + i);
+      const __m128d b_vals = _mm_loadu_pd(b + i);
+      if (_mm_movemask_pd(_mm_cmplt_pd(a_vals, b_vals))) return false;
+      greater |= (bool)_mm_movemask_pd(_mm_cmpgt_pd(a_vals, b_vals));
+    }
+    #endif
+    for (; i < num_objs; ++i) {
+      if (a[i] < b[i]) return false;
+      greater |= (a[i] > b[i]);
+    }
+    return greater;
+  }
+
+  /// Each vector<double> in score table represents a single candidate's scores on a set of goals/objectives
+  /// NOTE - this is the reference implementation (O(n^2 k)); find_pareto_front_fast is much faster for large tables.
+  inline emp::vector<size_t> find_pareto_front(const emp::vector< emp::vector<double> >& score_table) {
 
     const size_t num_candidates = score_table.size();
 
@@ -56,5 +88,279 @@ namespace dirdevo {
     return front;
   }
 
+  /// Find the pareto front (the ids of all non-dominated rows) of a flat score matrix, where each row is a
+  /// candidate and each column is an objective. Front ids are written to front in ascending order.
+  /// Gives the same front as find_pareto_front (candidates with identical scores are all kept).
+  /// - Two objectives: sort + sweep (O(n log n)).
+  /// - Otherwise: sort candidates by descending sum of scores. A candidate can only be dominated by candidates
+  ///   with a larger sum, so each candidate only needs to be compared against the (final) front members found
+  ///   before it (O(n log n + n f k) where f is the front size).
+  inline void find_pareto_front_fast(const ScoreMatrix& scores, emp::vector<size_t>& front) {
+    const size_t num_candidates = scores.GetNumRows();
+    const size_t num_objs = scores.GetNumCols();
+    front.clear();
+    if (!num_candidates) return;
+
+    emp::vector<size_t> order(num_candidates);
+    std::iota(order.begin(), order.end(), 0);
+
+    if (num_objs == 2) {
+      // Sort by first objective (descending), then second objective (descending).
+      std::sort(
+        order.begin(),
+        order.end(),
+        [&scores](size_t a, size_t b) {
+          if (scores(a, 0) != scores(b, 0)) return scores(a, 0) > scores(b, 0);
+          if (scores(a, 1) != scores(b, 1)) return scores(a, 1) > scores(b, 1);
+          return a < b;
+        }
+      );
+      // A candidate is dominated if something with a larger first score has at least as large a second score,
+      // or if something with the same first score has a larger second score.
+      bool have_prev_groups = false;
+      double prev_groups_max = std::numeric_limits<double>::lowest(); // Max second score in groups with larger first scores
+      size_t group_begin = 0;
+      while (group_begin < num_candidates) {
+        const double group_first = scores(order[group_begin], 0);
+        const double group_max = scores(order[group_begin], 1);
+        size_t i = group_begin;
+        for (; i < num_candidates && scores(order[i], 0) == group_first; ++i) {
+          const double second = scores(order[i], 1);
+          const bool dominated = (have_prev_groups && prev_groups_max >= second) || (group_max > second);
+          if (!dominated) front.emplace_back(order[i]);
+        }
+        prev_groups_max = (have_prev_groups) ? std::max(prev_groups_max, group_max) : group_max;
+        have_prev_groups = true;
+        group_begin = i;
+      }
+    } else {
+      emp::vector<double> sums(num_candidates, 0.0);
+      for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
+        const double* row = scores.GetRow(cand_i);
+        for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) sums[cand_i] += row[obj_i];
+      }
+      // Floating point addition is monotonic, so a dominating candidate can never have a smaller sum.
+      // Break ties lexicographically (descending) so that a dominating candidate always comes first.
+      std::sort(
+        order.begin(),
+        order.end(),
+        [&scores, &sums, num_objs](size_t a, size_t b) {
+          if (sums[a] != sums[b]) return sums[a] > sums[b];
+          const double* row_a = scores.GetRow(a);
+          const double* row_b = scores.GetRow(b);
+          for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) {
+            if (row_a[obj_i] != row_b[obj_i]) return row_a[obj_i] > row_b[obj_i];
+          }
+          return a < b;
+        }
+      );
+      for (size_t cand_id : order) {
+        const double* cand_row = scores.GetRow(cand_id);
+        bool dominated = false;
+        for (size_t front_id : front) {
+          if (dominates_row(scores.GetRow(front_id), cand_row, num_objs)) {
+            dominated = true;
+            break;
+          }
+        }
+        if (!dominated) front.emplace_back(cand_id);
+      }
+    }
+
+    std::sort(front.begin(), front.end());
+  }
+
+  /// Find the pareto front of a flat score matrix (see above). Returns front ids in ascending order.
+  inline emp::vector<size_t> find_pareto_front_fast(const ScoreMatrix& scores) {
+    emp::vector<size_t> front;
+    find_pareto_front_fast(scores, front);
+    return front;
+  }
+
+  /// Sort candidates (rows of a score matrix) into non-dominated fronts (NSGA-II style): fronts[0] is the pareto
+  /// front, fronts[1] is the pareto front once fronts[0] is removed, etc. ranks[id] gives the front index of each
+  /// candidate. Ids within each front are in ascending order.
+  ///
+  /// Candidates are visited in an order where nothing can be dominated by a later candidate (descending summed
+  /// score), and each candidate is placed in the first front with no member that dominates it (found by binary
+  /// search because fronts are nested; see Zhang et al. 2015, efficient non-dominated sort).
+  /// Domination is checked with bitsets (over visit order positions) instead of pairwise comparisons: a candidate's
+  /// dominators are the earlier candidates that score at least as well on every objective, which is the AND (across
+  /// objectives) of "scores at least as well on this objective" sets. Those sets are prefixes of each objective's
+  /// sorted order, so they are built from precomputed checkpoint bitsets. Overall: O(n k (n/64 + stride)) time.
+  inline void non_dominated_sort(
+    const ScoreMatrix& scores,
+    emp::vector< emp::vector<size_t> >& fronts,
+    emp::vector<size_t>& ranks
+  ) {
+    const size_t num_candidates = scores.GetNumRows();
+    const size_t num_objs = scores.GetNumCols();
+    fronts.clear();
+    ranks.resize(num_candidates);
+    if (!num_candidates) return;
+
+    // Visit candidates in descending order of summed score (ties broken lexicographically; see find_pareto_front_fast).
+    emp::vector<double> sums(num_candidates, 0.0);
+    for (size_t cand_i = 0; cand_i < num_candidates; ++cand_i) {
+      const double* row = scores.GetRow(cand_i);
+      for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) sums[cand_i] += row[obj_i];
+    }
+    emp::vector<size_t> order(num_candidates);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(
+      order.begin(),
+      order.end(),
+      [&scores, &sums, num_objs](size_t a, size_t b) {
+        if (sums[a] != sums[b]) return sums[a] > sums[b];
+        const double* row_a = scores.GetRow(a);
+        const double* row_b = scores.GetRow(b);
+        for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) {
+          if (row_a[obj_i] != row_b[obj_i]) return row_a[obj_i] > row_b[obj_i];
+        }
+        return a < b;
+      }
+    );
+
+    // Everything from here on is in terms of visit order positions.
+    const size_t num_words = (num_candidates + 63) / 64;
+    const size_t stride = std::max<size_t>(64, num_candidates / 256); // Positions between checkpoints (bounds memory use)
+    const size_t num_checkpoints = (num_candidates + stride - 1) / stride + 1;
+    emp::vector<size_t> obj_sorted(num_objs * num_candidates);  ///< Per objective: positions sorted by descending score
+    emp::vector<size_t> ge_counts(num_objs * num_candidates);   ///< Per objective: number of positions scoring >= each position
+    emp::vector<uint64_t> checkpoints(num_objs * num_checkpoints * num_words, 0); ///< Per objective: bitset of first i*stride positions in obj_sorted
+    emp::vector<double> column(num_candidates);
+    for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) {
+      for (size_t pos = 0; pos < num_candidates; ++pos) column[pos] = scores(order[pos], obj_i);
+      size_t* sorted = obj_sorted.data() + obj_i * num_candidates;
+      std::iota(sorted, sorted + num_candidates, 0);
+      std::sort(sorted, sorted + num_candidates, [&column](size_t a, size_t b) { return column[a] > column[b]; });
+      size_t* ge = ge_counts.data() + obj_i * num_candidates;
+      for (size_t i = 0; i < num_candidates; ) {
+        size_t j = i;
+        while (j < num_candidates && column[sorted[j]] == column[sorted[i]]) ++j;
+        for (size_t t = i; t < j; ++t) ge[sorted[t]] = j;
+        i = j;
+      }
+      uint64_t* obj_checkpoints = checkpoints.data() + obj_i * num_checkpoints * num_words;
+      for (size_t cp_i = 1; cp_i < num_checkpoints; ++cp_i) {
+        uint64_t* cp = obj_checkpoints + cp_i * num_words;
+        std::copy(cp - num_words, cp, cp);
+        for (size_t i = (cp_i - 1) * stride; i < std::min(cp_i * stride, num_candidates); ++i) {
+          cp[sorted[i] / 64] |= (uint64_t)1 << (sorted[i] % 64);
+        }
+      }
+    }
+
+    emp::vector<uint64_t> dominators(num_words);
+    emp::vector< emp::vector<uint64_t> > front_bits;  ///< Members of each front (by position)
+    auto add_to_front = [&](size_t front_i, size_t pos) {
+      if (front_i == fronts.size()) {
+        fronts.emplace_back();
+        front_bits.emplace_back(num_words, 0);
+      }
+      fronts[front_i].emplace_back(order[pos]);
+      front_bits[front_i][pos / 64] |= (uint64_t)1 << (pos % 64);
+      ranks[order[pos]] = front_i;
+    };
+
+    for (size_t pos = 0; pos < num_candidates; ++pos) {
+      const double* cand_row = scores.GetRow(order[pos]);
+      // Identical score vectors are adjacent in the visit order and always share a front.
+      if (pos && std::equal(cand_row, cand_row + num_objs, scores.GetRow(order[pos - 1]))) {
+        add_to_front(ranks[order[pos - 1]], pos);
+        continue;
+      }
+      // Only earlier positions can dominate this candidate. Every earlier position scoring at least as well on
+      // every objective does dominate it (identical score vectors were handled above).
+      const size_t words = (pos + 63) / 64;
+      if (!words) {
+        add_to_front(0, pos);
+        continue;
+      }
+      // Start from the first checkpoint that contains each objective's ">=" set, then clear the extra bits.
+      // Only the range of words that can still have set bits, [lo, hi), needs to be ANDed with later objectives.
+      size_t lo = 0;
+      size_t hi = words;
+      for (size_t obj_i = 0; obj_i < num_objs && lo < hi; ++obj_i) {
+        const size_t ge = ge_counts[obj_i * num_candidates + pos];
+        const size_t cp_i = (ge + stride - 1) / stride;
+        const uint64_t* cp = checkpoints.data() + (obj_i * num_checkpoints + cp_i) * num_words;
+        if (obj_i) {
+          for (size_t w = lo; w < hi; ++w) dominators[w] &= cp[w];
+        } else {
+          std::copy(cp, cp + words, dominators.begin());
+          if (pos % 64) dominators[words - 1] &= ((uint64_t)1 << (pos % 64)) - 1;
+        }
+        const size_t* sorted = obj_sorted.data() + obj_i * num_candidates;
+        for (size_t i = ge; i < std::min(cp_i * stride, num_candidates); ++i) {
+          if (sorted[i] < pos) dominators[sorted[i] / 64] &= ~((uint64_t)1 << (sorted[i] % 64));
+        }
+        while (lo < hi && !dominators[lo]) ++lo;
+        while (lo < hi && !dominators[hi - 1]) --hi;
+      }
+      if (!num_objs) hi = lo;
+
+      // Binary search for the first front that does not dominate this candidate.
+      auto dominated_by_front = [&front_bits, &dominators, lo, hi](size_t front_i) {
+        const auto& bits = front_bits[front_i];
+        for (size_t w = lo; w < hi; ++w) {
+          if (dominators[w] & bits[w]) return true;
+        }
+        return false;
+      };
+      size_t low = 0;
+      size_t high = fronts.size();
+      while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (dominated_by_front(mid)) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      add_to_front(low, pos);
+    }
+
+    for (auto& front : fronts) {
+      std::sort(front.begin(), front.end());
+    }
+  }
+
+  /// Compute the crowding distance (NSGA-II) of each member of a front. Distances are written to
+  /// distances[id] for each candidate id in the front (distances must already be sized to the number of candidates).
+  /// Members at the extremes of any objective get an infinite distance.
+  inline void crowding_distances(
+    const ScoreMatrix& scores,
+    const emp::vector<size_t>& front,
+    emp::vector<double>& distances
+  ) {
+    const size_t num_objs = scores.GetNumCols();
+    const size_t front_size = front.size();
+    for (size_t id : front) {
+      emp_assert(id < distances.size(), id, distances.size());
+      distances[id] = 0.0;
+    }
+    if (front_size < 3) {
+      for (size_t id : front) distances[id] = std::numeric_limits<double>::infinity();
+      return;
+    }
+    emp::vector<size_t> sorted(front);
+    for (size_t obj_i = 0; obj_i < num_objs; ++obj_i) {
+      std::sort(
+        sorted.begin(),
+        sorted.end(),
+        [&scores, obj_i](size_t a, size_t b) { return scores(a, obj_i) < scores(b, obj_i); }
+      );
+      const double min_score = scores(sorted.front(), obj_i);
+      const double max_score = scores(sorted.back(), obj_i);
+      distances[sorted.front()] = std::numeric_limits<double>::infinity();
+      distances[sorted.back()] = std::numeric_limits<double>::infinity();
+      if (max_score <= min_score) continue;
+      const double range = max_score - min_score;
+      for (size_t i = 1; i + 1 < front_size; ++i) {
+        distances[sorted[i]] += (scores(sorted[i+1], obj_i) - scores(sorted[i-1], obj_i)) / range;
+      }
+    }
+  }
 
-}
\ No newline at end of file
+}
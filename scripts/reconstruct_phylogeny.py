@@ -0,0 +1,71 @@
+"""
+Rebuild a phylogeny snapshot from a phylogeny event log (phylogeny_events.csv).
+
+Experiments run with OUTPUT_PHYLOGENY_FORMAT=events append taxon events (new, extinct, prune) to a single log,
+with a marker at the end of every epoch, instead of rewriting the full phylogeny every few epochs.
+This script replays the log up to the requested epoch's marker and writes the phylogeny as it stood at that point
+(in the same layout as Empirical's Systematics::Snapshot: id, ancestor_list, origin_time, destruction_time).
+
+Usage: python reconstruct_phylogeny.py phylogeny_events.csv [--epoch EPOCH] [--output FILE]
+- By default, the phylogeny at the last epoch in the log is written to phylogeny_<epoch>.csv (next to the log).
+"""
+
+import argparse, csv, os
+
+def last_epoch(log_path):
+    """Find the last epoch marked in the event log."""
+    epoch = None
+    with open(log_path, "r") as fp:
+        for line in csv.DictReader(fp):
+            if line["event"] == "epoch":
+                epoch = int(line["id"])
+    if epoch is None:
+        raise ValueError(f"No epochs found in {log_path}")
+    return epoch
+
+def replay(log_path, epoch):
+    """
+    Replay the event log up to (and including) the given epoch's marker.
+    Returns taxa: a map from taxon id to [parent id, origin time, destruction time (None if still alive)].
+    """
+    taxa = {}
+    with open(log_path, "r") as fp:
+        for line in csv.DictReader(fp):
+            event = line["event"]
+            if event == "new":
+                taxa[line["id"]] = [line["parent_id"], line["time"], None]
+            elif event == "extinct":
+                taxa[line["id"]][2] = line["time"]
+            elif event == "prune":
+                del taxa[line["id"]]
+            elif event == "epoch":
+                if int(line["id"]) == epoch:
+                    return taxa
+            else:
+                raise ValueError(f"Unknown event type: {event}")
+    raise ValueError(f"Epoch {epoch} not found in {log_path}")
+
+def write_snapshot(taxa, out_path):
+    with open(out_path, "w") as fp:
+        fp.write("id,ancestor_list,origin_time,destruction_time\n")
+        for taxon_id in sorted(taxa, key=int):
+            parent_id, origin_time, destruction_time = taxa[taxon_id]
+            ancestors = "[NONE]" if parent_id == "-1" else f"[{parent_id}]"
+            destruction = "inf" if destruction_time is None else destruction_time
+            fp.write(f"{taxon_id},{ancestors},{origin_time},{destruction}\n")
+
+def main():
+    parser = argparse.ArgumentParser(description="Rebuild a phylogeny snapshot from a phylogeny event log.")
+    parser.add_argument("log", type=str, help="Path to phylogeny_events.csv")
+    parser.add_argument("--epoch", type=int, default=None, help="Epoch to rebuild (default: last epoch in the log)")
+    parser.add_argument("--output", type=str, default=None, help="Output file (default: phylogeny_<epoch>.csv next to the log)")
+    args = parser.parse_args()
+
+    epoch = args.epoch if args.epoch is not None else last_epoch(args.log)
+    taxa = replay(args.log, epoch)
+    out_path = args.output if args.output is not None else os.path.join(os.path.dirname(args.log), f"phylogeny_{epoch}.csv")
+    write_snapshot(taxa, out_path)
+    print(f"Wrote {len(taxa)} taxa (epoch {epoch}) to {out_path}")
+
+if __name__ == "__main__":
+    main()
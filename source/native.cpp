@@ -2,66 +2,45 @@
 //  Copyright (C) Alexander Lalejini, 2021.
 //  Released under MIT license; see LICENSE
 
+#include <cstring>
 #include <iostream>
 
 #include "emp/base/vector.hpp"
 
 #include "dirdevo/utility/config_setup.hpp"
 #include "dirdevo/DirectedDevoConfig.hpp"
-#include "dirdevo/DirectedDevoExperiment.hpp"
 
-// ONE MAX
-#include "dirdevo/mutator/BitSetMutator.hpp"
-#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
-#include "dirdevo/ExperimentSetups/OneMax/OneMaxTask.hpp"
-
-// SGP-LITE
-// #include "directed-digital-evolution/Organism/SGPLiteOrganism.hpp"
-
-// AVIDAGP
-#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPOrganism.hpp"
-#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMutator.hpp"
-#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMultiPathwayTask.hpp"
+#include "setups/setups.hpp"
 
 // This is the main function for the NATIVE version of directed-digital-evolution.
+// The experiment setup (organism/task/mutator types) is picked at runtime with EXPERIMENT_SETUP; every setup is
+// compiled in (see source/setups/).
 
 dirdevo::DirectedDevoConfig cfg;
 
 int main(int argc, char* argv[])
 {
-
-  // Things that need to be configured at compile time:
-  // - Organism type
-  // - Mutator?
-
-  // TODO - configure compile time flags to switch between configurations (or just have multiple .cpp?)
-
-  ///////////////////////////////////////////////////////
-  // OneMax
-  ///////////////////////////////////////////////////////
-  // using org_t = dirdevo::OneMaxOrganism<256>;
-  // using task_t = dirdevo::OneMaxTask<org_t>;
-  // using mutator_t = dirdevo::BitSetMutator;
-  // using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
-  // using experiment_t = dirdevo::DirectedDevoExperiment<world_t, org_t, mutator_t, task_t>;
-  ///////////////////////////////////////////////////////
-
-  ///////////////////////////////////////////////////////
-  // AvidaGP Multipathway
-  ///////////////////////////////////////////////////////
-  using org_t = dirdevo::AvidaGPOrganism;
-  using task_t = dirdevo::AvidaGPMultiPathwayTask;
-  using mutator_t = dirdevo::AvidaGPMutator;
-  using world_t = dirdevo::DirectedDevoWorld<org_t,task_t>;
-  using experiment_t = dirdevo::DirectedDevoExperiment<world_t, org_t, mutator_t, task_t>;
-  ///////////////////////////////////////////////////////
+  // avidagp-ec isn't a directed evolution experiment (it has its own configuration and command line options), so it
+  // must be picked out before we parse the directed evolution configuration.
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (std::strcmp(argv[i], "-EXPERIMENT_SETUP") || std::strcmp(argv[i + 1], "avidagp-ec")) continue;
+    emp::vector<char*> ec_args(argv, argv + argc);
+    ec_args.erase(ec_args.begin() + i, ec_args.begin() + i + 2);
+    return dirdevo::setups::run_avidagp_ec((int)ec_args.size(), ec_args.data());
+  }
 
   // Set up a configuration panel for native application
   setup_config_native(cfg, argc, argv);
   cfg.Write(std::cout);
 
-  experiment_t experiment(cfg);
-  experiment.Run();
-
-  return 0;
+  const auto& setups = dirdevo::setups::get_experiment_setups();
+  const auto setup = setups.find(cfg.EXPERIMENT_SETUP());
+  if (setup == setups.end()) {
+    std::cout << "Unknown EXPERIMENT_SETUP: " << cfg.EXPERIMENT_SETUP() << std::endl;
+    std::cout << "Options:";
+    for (const auto& entry : setups) std::cout << " " << entry.first;
+    std::cout << " avidagp-ec (command line only)" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return setup->second(cfg);
 }
@@ -0,0 +1,32 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+// Precompiled header for the native build (see Makefile, USE_PCH).
+// Only put stable, external headers (standard library, Empirical) here: every object is rebuilt when this changes.
+// (No include guard: this is only ever force-included once, with -include.)
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/config/config.hpp"
+#include "emp/data/DataFile.hpp"
+#include "emp/datastructs/IndexMap.hpp"
+#include "emp/datastructs/vector_utils.hpp"
+#include "emp/Evolve/Systematics.hpp"
+#include "emp/Evolve/World.hpp"
+#include "emp/math/Random.hpp"
+#include "emp/tools/string_utils.hpp"
@@ -4,6 +4,8 @@
 
 #include <iostream>
 
+#include "setups.hpp"
+
 #include "emp/base/vector.hpp"
 #include "emp/config/ArgManager.hpp"
 #include "emp/config/command_line.hpp"
@@ -11,7 +13,7 @@
 // AVIDAGP
 #include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPEC.hpp"
 
-int main(int argc, char* argv[])
+int dirdevo::setups::run_avidagp_ec(int argc, char* argv[])
 {
 
   std::string config_fname = "avidagp-ec-config.cfg";
@@ -0,0 +1,18 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+#include "setups.hpp"
+#include "run_experiment.hpp"
+#include "avidagp_types.hpp"
+
+template class dirdevo::DirectedDevoExperiment<
+  dirdevo::setups::avidagp_multipathway_t::world_t,
+  dirdevo::AvidaGPOrganism,
+  dirdevo::AvidaGPMutator,
+  dirdevo::AvidaGPMultiPathwayTask
+>;
+
+int dirdevo::setups::run_avidagp_multipathway(const DirectedDevoConfig& config) {
+  return run_experiment<avidagp_multipathway_t::experiment_t>(config);
+}
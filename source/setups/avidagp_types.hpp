@@ -0,0 +1,36 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+// Concrete AvidaGP directed evolution world/experiment types.
+// The world is explicitly instantiated in source/setups/worlds/avidagp-multipathway.cpp and the experiment in
+// source/setups/avidagp-multipathway.cpp (see onemax_types.hpp).
+
+#pragma once
+
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/DirectedDevoExperiment.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPOrganism.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMutator.hpp"
+#include "dirdevo/ExperimentSetups/AvidaGP/AvidaGPMultiPathwayTask.hpp"
+
+namespace dirdevo {
+namespace setups {
+
+struct AvidaGPMultiPathwayTypes {
+  using org_t = AvidaGPOrganism;
+  using task_t = AvidaGPMultiPathwayTask;
+  using world_t = DirectedDevoWorld<org_t, task_t>;
+  using experiment_t = DirectedDevoExperiment<world_t, org_t, AvidaGPMutator, task_t>;
+};
+
+using avidagp_multipathway_t = AvidaGPMultiPathwayTypes;
+
+} // namespace setups
+
+extern template class DirectedDevoWorld<AvidaGPOrganism, AvidaGPMultiPathwayTask>;
+extern template class DirectedDevoExperiment<
+  setups::avidagp_multipathway_t::world_t, AvidaGPOrganism, AvidaGPMutator, AvidaGPMultiPathwayTask
+>;
+
+} // namespace dirdevo
@@ -0,0 +1,18 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+#include "setups.hpp"
+#include "run_experiment.hpp"
+#include "onemax_types.hpp"
+
+template class dirdevo::DirectedDevoExperiment<
+  dirdevo::setups::onemax_64_t::world_t,
+  dirdevo::setups::onemax_64_t::org_t,
+  dirdevo::BitSetMutator,
+  dirdevo::setups::onemax_64_t::task_t
+>;
+
+int dirdevo::setups::run_onemax_64(const DirectedDevoConfig& config) {
+  return run_experiment<onemax_64_t::experiment_t>(config);
+}
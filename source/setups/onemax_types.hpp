@@ -0,0 +1,49 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+// Concrete OneMax world/experiment types.
+// The worlds are explicitly instantiated in source/setups/worlds/onemax-<size>.cpp and the experiments in
+// source/setups/onemax-<size>.cpp; the extern declarations below stop every other translation unit from instantiating
+// them again (so the world and experiment instantiations compile in parallel).
+
+#pragma once
+
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/DirectedDevoExperiment.hpp"
+#include "dirdevo/mutator/BitSetMutator.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxTask.hpp"
+
+namespace dirdevo {
+namespace setups {
+
+template<size_t GENOME_SIZE>
+struct OneMaxTypes {
+  using org_t = OneMaxOrganism<GENOME_SIZE>;
+  using task_t = OneMaxTask<org_t>;
+  using world_t = DirectedDevoWorld<org_t, task_t>;
+  using experiment_t = DirectedDevoExperiment<world_t, org_t, BitSetMutator, task_t>;
+};
+
+using onemax_64_t = OneMaxTypes<64>;
+using onemax_256_t = OneMaxTypes<256>;
+using onemax_1024_t = OneMaxTypes<1024>;
+
+} // namespace setups
+
+extern template class DirectedDevoWorld<setups::onemax_64_t::org_t, setups::onemax_64_t::task_t>;
+extern template class DirectedDevoWorld<setups::onemax_256_t::org_t, setups::onemax_256_t::task_t>;
+extern template class DirectedDevoWorld<setups::onemax_1024_t::org_t, setups::onemax_1024_t::task_t>;
+
+extern template class DirectedDevoExperiment<
+  setups::onemax_64_t::world_t, setups::onemax_64_t::org_t, BitSetMutator, setups::onemax_64_t::task_t
+>;
+extern template class DirectedDevoExperiment<
+  setups::onemax_256_t::world_t, setups::onemax_256_t::org_t, BitSetMutator, setups::onemax_256_t::task_t
+>;
+extern template class DirectedDevoExperiment<
+  setups::onemax_1024_t::world_t, setups::onemax_1024_t::org_t, BitSetMutator, setups::onemax_1024_t::task_t
+>;
+
+} // namespace dirdevo
@@ -0,0 +1,22 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+#pragma once
+
+#include "dirdevo/DirectedDevoConfig.hpp"
+
+namespace dirdevo {
+namespace setups {
+
+/// Build and run a directed evolution experiment.
+/// EXPERIMENT_T should be explicitly instantiated by the setup's translation unit (see onemax_types.hpp).
+template<typename EXPERIMENT_T>
+int run_experiment(const DirectedDevoConfig& config) {
+  EXPERIMENT_T experiment(config);
+  experiment.Run();
+  return 0;
+}
+
+} // namespace setups
+} // namespace dirdevo
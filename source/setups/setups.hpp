@@ -0,0 +1,44 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+// Experiment setups compiled into the directed-digital-evolution executable.
+// Each setup's experiment is explicitly instantiated in its own translation unit (source/setups/<setup>.cpp) and its
+// world in source/setups/worlds/<setup>.cpp, so setups compile in parallel and changing one setup only recompiles
+// that setup. The setup objects are archived into libdirdevo.a (see Makefile).
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include "dirdevo/DirectedDevoConfig.hpp"
+
+namespace dirdevo {
+namespace setups {
+
+/// Runs a directed evolution experiment (the config must outlive the run).
+using experiment_setup_fun_t = std::function<int(const DirectedDevoConfig&)>;
+
+int run_onemax_64(const DirectedDevoConfig& config);
+int run_onemax_256(const DirectedDevoConfig& config);
+int run_onemax_1024(const DirectedDevoConfig& config);
+int run_avidagp_multipathway(const DirectedDevoConfig& config);
+
+/// AvidaGP evolutionary computation (not a directed evolution experiment; reads its own configuration).
+int run_avidagp_ec(int argc, char* argv[]);
+
+/// Directed evolution experiment setups, by EXPERIMENT_SETUP name.
+inline const std::map<std::string, experiment_setup_fun_t>& get_experiment_setups() {
+  static const std::map<std::string, experiment_setup_fun_t> setups={
+    {"onemax-64", run_onemax_64},
+    {"onemax-256", run_onemax_256},
+    {"onemax-1024", run_onemax_1024},
+    {"avidagp-multipathway", run_avidagp_multipathway}
+  };
+  return setups;
+}
+
+} // namespace setups
+} // namespace dirdevo
@@ -0,0 +1,7 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+#include "../avidagp_types.hpp"
+
+template class dirdevo::DirectedDevoWorld<dirdevo::AvidaGPOrganism, dirdevo::AvidaGPMultiPathwayTask>;
@@ -0,0 +1,10 @@
+//  This file is part of directed-digital-evolution
+//  Copyright (C) Alexander Lalejini, 2021.
+//  Released under MIT license; see LICENSE
+
+#include "../onemax_types.hpp"
+
+template class dirdevo::DirectedDevoWorld<
+  dirdevo::setups::onemax_64_t::org_t,
+  dirdevo::setups::onemax_64_t::task_t
+>;
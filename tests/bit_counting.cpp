@@ -0,0 +1,86 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cstdint>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/BitColumnCounter.hpp"
+
+namespace {
+
+/// Random bit strings (stored as 64-bit words; bits past num_bits are 0)
+emp::vector< emp::vector<uint64_t> > RandomBitStrings(emp::Random& random, size_t num_strings, size_t num_bits, double p) {
+  const size_t num_words = (num_bits + 63) / 64;
+  emp::vector< emp::vector<uint64_t> > strings(num_strings, emp::vector<uint64_t>(num_words, 0));
+  for (auto& str : strings) {
+    for (size_t bit = 0; bit < num_bits; ++bit) {
+      if (random.P(p)) str[bit / 64] |= (uint64_t)1 << (bit % 64);
+    }
+  }
+  return strings;
+}
+
+/// Count ones at each position, one bit at a time.
+emp::vector<size_t> NaiveColumnCounts(const emp::vector< emp::vector<uint64_t> >& strings, size_t num_bits) {
+  emp::vector<size_t> counts(num_bits, 0);
+  for (const auto& str : strings) {
+    for (size_t bit = 0; bit < num_bits; ++bit) {
+      counts[bit] += (str[bit / 64] >> (bit % 64)) & 1;
+    }
+  }
+  return counts;
+}
+
+}
+
+TEST_CASE("BitColumnCounter matches per-bit counting", "[utility][BitColumnCounter]")
+{
+  emp::Random random(2);
+  dirdevo::BitColumnCounter counter;
+  REQUIRE(counter.GetCounts().size() == 0);
+
+  for (size_t num_bits : {1, 63, 64, 65, 128, 200, 1000}) {
+    for (double p : {0.0, 0.1, 0.5, 1.0}) {
+      for (size_t num_strings : {0, 1, 3, 100, 1000}) {
+        const auto strings = RandomBitStrings(random, num_strings, num_bits, p);
+        counter.Reset(num_bits);
+        REQUIRE(counter.GetNumBits() == num_bits);
+        REQUIRE(counter.GetNumWords() == (num_bits + 63) / 64);
+        for (const auto& str : strings) {
+          counter.Add([&str](size_t w) { return str[w]; });
+        }
+        REQUIRE(counter.GetCounts() == NaiveColumnCounts(strings, num_bits));
+      }
+    }
+  }
+}
+
+TEST_CASE("BitColumnCounter keeps counting after reading counts", "[utility][BitColumnCounter]")
+{
+  emp::Random random(3);
+  const size_t num_bits = 130;
+  const auto strings = RandomBitStrings(random, 50, num_bits, 0.5);
+  dirdevo::BitColumnCounter counter(num_bits);
+  for (size_t i = 0; i < strings.size(); ++i) {
+    counter.Add([&strings, i](size_t w) { return strings[i][w]; });
+    // Counts so far
+    const emp::vector< emp::vector<uint64_t> > added(strings.begin(), strings.begin() + (std::ptrdiff_t)i + 1);
+    REQUIRE(counter.GetCounts() == NaiveColumnCounts(added, num_bits));
+  }
+}
+
+TEST_CASE("BitColumnCounter does not overflow its bit-sliced counters", "[utility][BitColumnCounter]")
+{
+  // Add enough all-ones strings to force (at least) one flush of the sliced counters.
+  const size_t num_bits = 70;
+  const size_t num_strings = dirdevo::BitColumnCounter::MAX_PENDING + 10;
+  const uint64_t tail_mask = ((uint64_t)1 << (num_bits - 64)) - 1;
+  dirdevo::BitColumnCounter counter(num_bits);
+  for (size_t i = 0; i < num_strings; ++i) {
+    counter.Add([tail_mask](size_t w) { return (w == 0) ? ~(uint64_t)0 : tail_mask; });
+  }
+  REQUIRE(counter.GetCounts() == emp::vector<size_t>(num_bits, num_strings));
+}
@@ -0,0 +1,144 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "emp/base/vector.hpp"
+
+#include "dirdevo/utility/CsvReader.hpp"
+
+namespace {
+
+void write_file(const std::string& path, const std::string& contents) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file << contents;
+}
+
+/// Read the given columns of every row in the given chunks (as strings, joined by '|').
+emp::vector<std::string> read_rows(
+  const dirdevo::CsvReader& reader,
+  const emp::vector<dirdevo::CsvReader::Chunk>& chunks,
+  const emp::vector<size_t>& columns
+) {
+  emp::vector<std::string> rows;
+  for (const auto& chunk : chunks) {
+    reader.ForEachRow(chunk, columns, [&rows](const dirdevo::CsvReader::Row& row) {
+      std::string line;
+      for (size_t i = 0; i < row.GetNumFields(); ++i) {
+        if (i) line += "|";
+        line += std::string(row[i]);
+      }
+      rows.emplace_back(line);
+    });
+  }
+  return rows;
+}
+
+}
+
+TEST_CASE("CSV reader columns and fields", "[csv_reader]") {
+  const std::string path = "csv_reader_test.csv";
+  // CRLF line endings, quoted fields (with commas), a blank line, and no trailing newline.
+  write_file(path,
+    "id,\"name\",value,note\r\n"
+    "1,alpha,0.5,\"x, y\"\r\n"
+    "\r\n"
+    "2,\"beta, gamma\",-3,\r\n"
+    "3,delta,7,last"
+  );
+
+  dirdevo::CsvReader reader;
+  REQUIRE(reader.Open(path));
+  REQUIRE(reader.GetHeader() == emp::vector<std::string>({"id", "name", "value", "note"}));
+  REQUIRE(reader.GetColumn("value") == 2);
+  REQUIRE(reader.GetColumn("missing") == dirdevo::CsvReader::NO_COLUMN);
+
+  std::string missing;
+  reader.GetColumns({"id", "missing", "note"}, missing);
+  REQUIRE(missing == "missing");
+
+  // Columns can be requested in any order.
+  const emp::vector<size_t> columns = reader.GetColumns({"value", "name", "note"}, missing);
+  REQUIRE(missing.empty());
+  REQUIRE(read_rows(reader, {reader.GetBody()}, columns) == emp::vector<std::string>({
+    "0.5|alpha|x, y",
+    "-3|beta, gamma|",
+    "7|delta|last"
+  }));
+
+  // Numeric fields
+  emp::vector<double> values;
+  emp::vector<int> ids;
+  const size_t num_rows = reader.ForEachRow({reader.GetColumn("id"), reader.GetColumn("value"), reader.GetColumn("name")},
+    [&](const dirdevo::CsvReader::Row& row) {
+      ids.emplace_back(row.GetAs<int>(0));
+      values.emplace_back(row.GetAs<double>(1));
+      int not_a_number = 42;
+      REQUIRE(!row.Get(2, not_a_number));
+      REQUIRE(not_a_number == 42);
+    }
+  );
+  REQUIRE(num_rows == 3);
+  REQUIRE(ids == emp::vector<int>({1, 2, 3}));
+  REQUIRE(values == emp::vector<double>({0.5, -3, 7}));
+
+  reader.Close();
+  REQUIRE(!reader.IsOpen());
+  std::remove(path.c_str());
+}
+
+TEST_CASE("CSV reader chunks", "[csv_reader]") {
+  const std::string path = "csv_reader_chunks_test.csv";
+  std::string contents = "a,b,c\n";
+  emp::vector<std::string> expected;
+  for (size_t i = 0; i < 200; ++i) {
+    // Rows of varying length
+    const std::string b(i % 13, 'x');
+    contents += std::to_string(i) + "," + b + "," + std::to_string(i * i) + "\n";
+    expected.emplace_back(std::to_string(i * i) + "|" + std::to_string(i));
+  }
+  write_file(path, contents);
+
+  dirdevo::CsvReader reader(path);
+  REQUIRE(reader.IsOpen());
+  const emp::vector<size_t> columns = {reader.GetColumn("c"), reader.GetColumn("a")};
+  // Every row is read exactly once (in order) no matter how the file is split.
+  for (size_t num_chunks : {1, 2, 3, 7, 64, 1000, 100000}) {
+    const auto chunks = reader.Split(num_chunks);
+    REQUIRE(chunks.size() <= num_chunks);
+    REQUIRE(read_rows(reader, chunks, columns) == expected);
+  }
+  std::remove(path.c_str());
+
+  // Header-only and missing files
+  write_file(path, "a,b,c");
+  REQUIRE(reader.Open(path));
+  REQUIRE(reader.GetHeader().size() == 3);
+  REQUIRE(reader.Split(4).empty());
+  REQUIRE(read_rows(reader, {reader.GetBody()}, columns).empty());
+  std::remove(path.c_str());
+
+  REQUIRE(!reader.Open(path));
+  REQUIRE(!reader.GetError().empty());
+}
+
+TEST_CASE("CSV reader rejects duplicate column names", "[csv_reader]") {
+  const std::string path = "csv_reader_duplicates_test.csv";
+  write_file(path, "id,score,\"score\"\n1,2,3\n");
+
+  dirdevo::CsvReader reader;
+  REQUIRE(!reader.Open(path));
+  REQUIRE(!reader.IsOpen());
+  REQUIRE(reader.GetHeader().empty());
+  REQUIRE(reader.GetError().find("duplicate column name") != std::string::npos);
+  REQUIRE(reader.GetError().find("score") != std::string::npos);
+
+  // Names are compared exactly (case and all).
+  write_file(path, "id,score,Score\n1,2,3\n");
+  REQUIRE(reader.Open(path));
+  REQUIRE(reader.GetColumn("Score") == 2);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,271 @@
+#define CATCH_CONFIG_MAIN
+#define DIRDEVO_THREADING
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "emp/bits/BitSet.hpp"
+#include "emp/math/math.hpp"
+
+#include "dirdevo/BaseTask.hpp"
+#include "dirdevo/DirectedDevoConfig.hpp"
+#include "dirdevo/DirectedDevoExperiment.hpp"
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxTask.hpp"
+#include "dirdevo/mutator/BitSetMutator.hpp"
+#include "dirdevo/utility/CsvReader.hpp"
+
+using org_t = dirdevo::OneMaxOrganism<64>;
+using task_t = dirdevo::OneMaxTask<org_t>;
+using mutator_t = dirdevo::BitSetMutator;
+using world_t = dirdevo::DirectedDevoWorld<org_t, task_t>;
+using experiment_t = dirdevo::DirectedDevoExperiment<world_t, org_t, mutator_t, task_t>;
+
+/// OneMax worlds with a scripted running score: flat (always 1) or rising (the world's update), to check early stopping.
+template<bool RISING>
+class RunningScoreTask : public dirdevo::BaseTask<RunningScoreTask<RISING>, org_t> {
+public:
+  using this_t = RunningScoreTask<RISING>;
+  using base_t = dirdevo::BaseTask<this_t, org_t>;
+  using world_t = dirdevo::DirectedDevoWorld<org_t, this_t>;
+
+protected:
+  using base_t::aggregate_performance_fun;
+  using base_t::performance_fun_set;
+  using base_t::fresh_eval;
+  using base_t::world;
+
+public:
+  RunningScoreTask(world_t& w) : base_t(w) { ; }
+
+  static void AttachWorldUpdateDataFileFunctions(dirdevo::WorldAwareDataFile<world_t>& summary_file) { ; }
+
+  void OnWorldSetup() {
+    aggregate_performance_fun = [this]() { return GetRunningScore(); };
+    performance_fun_set.emplace_back(aggregate_performance_fun);
+    fresh_eval = false;
+  }
+
+  void Evaluate() { fresh_eval = true; }
+
+  double GetRunningScore() const { return (RISING) ? (double)world.GetUpdate() : 1.0; }
+};
+
+using flat_task_t = RunningScoreTask<false>;
+using rising_task_t = RunningScoreTask<true>;
+using flat_world_t = dirdevo::DirectedDevoWorld<org_t, flat_task_t>;
+using rising_world_t = dirdevo::DirectedDevoWorld<org_t, rising_task_t>;
+
+namespace {
+
+std::string read_file(const std::string& path) {
+  std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+emp::vector<emp::vector<std::string>> read_csv(const std::string& path, const emp::vector<std::string>& names) {
+  dirdevo::CsvReader reader(path);
+  REQUIRE(reader.IsOpen());
+  std::string missing;
+  const emp::vector<size_t> columns = reader.GetColumns(names, missing);
+  REQUIRE(missing.empty());
+  emp::vector<emp::vector<std::string>> rows;
+  reader.ForEachRow(columns, [&rows](const dirdevo::CsvReader::Row& row) {
+    rows.emplace_back();
+    for (size_t i = 0; i < row.GetNumFields(); ++i) rows.back().emplace_back(row[i]);
+  });
+  return rows;
+}
+
+/// Run a world seeded with one ancestor for num_updates updates, recording whether it had plateaued before each one.
+template<typename WORLD_T>
+emp::vector<bool> run_plateau_history(const dirdevo::DirectedDevoConfig& config, size_t num_updates) {
+  emp::Random random(config.SEED());
+  WORLD_T world(config, random, "world");
+  world.SetAvgOrgStepsPerUpdate(config.AVG_STEPS_PER_ORG());
+  mutator_t mutator;
+  mutator_t::Configure(mutator, config);
+  world.SetMutator(mutator);
+  world.InjectAt(org_t::GenerateAncestralGenome(world), 0);
+  world.SyncSchedulerWeights();
+  emp::vector<bool> plateaued;
+  for (size_t u = 0; u < num_updates; ++u) {
+    plateaued.emplace_back(world.HasPlateaued());
+    world.RunStep();
+    world.Update();
+  }
+  return plateaued;
+}
+
+/// A small experiment (a few short epochs) that writes its output to out_dir.
+void configure(dirdevo::DirectedDevoConfig& config, const std::string& out_dir, size_t num_threads) {
+  config.SEED(7);
+  config.NUM_POPS(6);
+  config.EPOCHS(3);
+  config.UPDATES_PER_EPOCH(50);
+  config.OUTPUT_SUMMARY_UPDATE_RESOLUTION(10);
+  config.LOCAL_GRID_WIDTH(5);
+  config.LOCAL_GRID_HEIGHT(5);
+  config.TRACK_SYSTEMATICS(false);
+  config.SELECTION_METHOD("tournament");
+  config.POPULATION_SAMPLING_SIZE(5);
+  config.OUTPUT_POPULATION_LIBRARY(false);
+  config.OUTPUT_DIR(out_dir);
+  config.NUM_THREADS(num_threads);
+}
+
+}
+
+TEST_CASE("World summaries don't depend on the number of threads", "[experiment]") {
+  const std::string serial_dir = "experiment_test_serial";
+  const std::string threaded_dir = "experiment_test_threaded";
+  std::filesystem::remove_all(serial_dir);
+  std::filesystem::remove_all(threaded_dir);
+
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, serial_dir, 1);
+    experiment_t experiment(config);
+    experiment.Run();
+  }
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, threaded_dir, 4);
+    experiment_t experiment(config);
+    experiment.Run();
+  }
+
+  const std::string serial_summary = read_file(serial_dir + "/world_summary.csv");
+  const std::string threaded_summary = read_file(threaded_dir + "/world_summary.csv");
+  // One header row, plus one row every OUTPUT_SUMMARY_UPDATE_RESOLUTION updates (0, 10, ..., 50) for each world in
+  // each epoch.
+  REQUIRE(std::count(serial_summary.begin(), serial_summary.end(), '\n') == 1 + 6 * 6 * 4);
+  REQUIRE(serial_summary == threaded_summary);
+  REQUIRE(read_file(serial_dir + "/world_evaluation.csv") == read_file(threaded_dir + "/world_evaluation.csv"));
+
+  std::filesystem::remove_all(serial_dir);
+  std::filesystem::remove_all(threaded_dir);
+}
+
+TEST_CASE("Threaded runs without world summaries", "[experiment]") {
+  const std::string out_dir = "experiment_test_no_summary";
+  std::filesystem::remove_all(out_dir);
+
+  dirdevo::DirectedDevoConfig config;
+  configure(config, out_dir, 4);
+  config.OUTPUT_COLLECT_WORLD_UPDATE_SUMMARY(false);
+  experiment_t experiment(config);
+  experiment.Run();
+  REQUIRE(!std::filesystem::exists(out_dir + "/world_summary.csv"));
+  REQUIRE(std::filesystem::exists(out_dir + "/world_evaluation.csv"));
+
+  std::filesystem::remove_all(out_dir);
+}
+
+TEST_CASE("Worlds stop early once their score plateaus", "[experiment]") {
+  dirdevo::DirectedDevoConfig config;
+  configure(config, "experiment_test_early_stop", 1);
+  config.EARLY_STOP_UPDATES(10);
+
+  // A flat score has plateaued once it has gone unchanged for more than EARLY_STOP_UPDATES updates (it's first
+  // recorded at update 0); a rising score never plateaus.
+  const emp::vector<bool> flat = run_plateau_history<flat_world_t>(config, 30);
+  for (size_t u = 0; u < flat.size(); ++u) {
+    REQUIRE(flat[u] == (u > 10));
+  }
+  const emp::vector<bool> rising = run_plateau_history<rising_world_t>(config, 30);
+  REQUIRE(std::find(rising.begin(), rising.end(), true) == rising.end());
+  // EARLY_STOP_UPDATES=0 (the default) turns early stopping off.
+  config.EARLY_STOP_UPDATES(0);
+  const emp::vector<bool> flat_no_early_stop = run_plateau_history<flat_world_t>(config, 30);
+  REQUIRE(std::find(flat_no_early_stop.begin(), flat_no_early_stop.end(), true) == flat_no_early_stop.end());
+}
+
+TEST_CASE("Early stops are recorded in early_stop.csv", "[experiment]") {
+  const std::string flat_dir = "experiment_test_early_stop_flat";
+  const std::string rising_dir = "experiment_test_early_stop_rising";
+  std::filesystem::remove_all(flat_dir);
+  std::filesystem::remove_all(rising_dir);
+  const emp::vector<std::string> columns = {"epoch", "world_id", "stop_update", "updates_skipped", "score"};
+
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, flat_dir, 1);
+    config.EARLY_STOP_UPDATES(10);
+    dirdevo::DirectedDevoExperiment<flat_world_t, org_t, mutator_t, flat_task_t> experiment(config);
+    experiment.Run();
+  }
+  // Every world stops at update 11 of every epoch, skipping the rest of the epoch's 51 updates (0 through 50).
+  const auto flat_rows = read_csv(flat_dir + "/early_stop.csv", columns);
+  REQUIRE(flat_rows.size() == 6 * 4);
+  for (size_t i = 0; i < flat_rows.size(); ++i) {
+    REQUIRE(flat_rows[i] == emp::vector<std::string>({std::to_string(i / 6), std::to_string(i % 6), "11", "40", "1"}));
+  }
+
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, rising_dir, 1);
+    config.EARLY_STOP_UPDATES(10);
+    dirdevo::DirectedDevoExperiment<rising_world_t, org_t, mutator_t, rising_task_t> experiment(config);
+    experiment.Run();
+  }
+  REQUIRE(read_csv(rising_dir + "/early_stop.csv", columns).empty());
+
+  std::filesystem::remove_all(flat_dir);
+  std::filesystem::remove_all(rising_dir);
+}
+
+TEST_CASE("Worlds that stop early keep the world summary cadence", "[experiment]") {
+  const std::string stepped_dir = "experiment_test_cadence_stepped";
+  const std::string skipped_dir = "experiment_test_cadence_skipped";
+  std::filesystem::remove_all(stepped_dir);
+  std::filesystem::remove_all(skipped_dir);
+  const emp::vector<std::string> columns = {"epoch", "world_id", "world_update", "num_orgs"};
+
+  // Same experiment, with and without early stopping (flat scores stop every world at update 11).
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, stepped_dir, 1);
+    dirdevo::DirectedDevoExperiment<flat_world_t, org_t, mutator_t, flat_task_t> experiment(config);
+    experiment.Run();
+  }
+  {
+    dirdevo::DirectedDevoConfig config;
+    configure(config, skipped_dir, 1);
+    config.EARLY_STOP_UPDATES(10);
+    dirdevo::DirectedDevoExperiment<flat_world_t, org_t, mutator_t, flat_task_t> experiment(config);
+    experiment.Run();
+  }
+
+  const auto stepped_rows = read_csv(stepped_dir + "/world_summary.csv", columns);
+  const auto skipped_rows = read_csv(skipped_dir + "/world_summary.csv", columns);
+  // Rows at updates 0, 10, ..., 50 for each world in each epoch, whether or not the world stopped early.
+  REQUIRE(stepped_rows.size() == 6 * 6 * 4);
+  REQUIRE(skipped_rows.size() == stepped_rows.size());
+  for (size_t i = 0; i < skipped_rows.size(); ++i) {
+    const size_t row_update = (i % 6) * 10;
+    for (const auto* rows : {&stepped_rows, &skipped_rows}) {
+      REQUIRE((*rows)[i][0] == std::to_string(i / 36));
+      REQUIRE((*rows)[i][1] == std::to_string((i / 6) % 6));
+      REQUIRE((*rows)[i][2] == std::to_string(row_update));
+    }
+    // After a stop, the stopped world is frozen. Before the first stop (in epoch 0), both runs are identical (later
+    // epochs start from different propagules).
+    if (row_update > 10) {
+      REQUIRE(skipped_rows[i][3] == skipped_rows[i - 1][3]);
+    } else if (i < 36) {
+      REQUIRE(skipped_rows[i] == stepped_rows[i]);
+    }
+  }
+
+  std::filesystem::remove_all(stepped_dir);
+  std::filesystem::remove_all(skipped_dir);
+}
@@ -0,0 +1,98 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/GenomeLibrary.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
+
+using org_t = dirdevo::OneMaxOrganism<64>;
+using genome_t = org_t::genome_t;
+
+TEST_CASE("Genome library round trip", "[genome_library]") {
+  const std::string path = "genome_library_test.ddgl";
+  emp::Random random(2);
+
+  // Slices with different numbers of genomes (including an empty slice)
+  const emp::vector<size_t> slice_sizes = {3, 0, 10, 1};
+  emp::vector<emp::vector<genome_t>> slices;
+  {
+    dirdevo::GenomeLibraryWriter<org_t> writer(path, slice_sizes.size(), "onemax-64");
+    REQUIRE(writer.IsOpen());
+    for (size_t slice_size : slice_sizes) {
+      writer.StartSlice();
+      slices.emplace_back();
+      for (size_t i = 0; i < slice_size; ++i) {
+        genome_t genome(false);
+        for (size_t bit = 0; bit < org_t::GENOME_SIZE; ++bit) genome.Set(bit, random.P(0.5));
+        writer.AddGenome(genome);
+        slices.back().emplace_back(genome);
+      }
+    }
+    REQUIRE(writer.Close());
+  }
+
+  dirdevo::GenomeLibrary library;
+  REQUIRE(library.Open(path));
+  REQUIRE(library.GetNumSlices() == slice_sizes.size());
+  REQUIRE(library.GetTag() == "onemax-64");
+  REQUIRE(library.GetGenomeSize() == org_t::GENOME_SIZE);
+  REQUIRE(library.Holds<org_t>("onemax-64"));
+  const int world = 0; // OneMax genomes don't need a world to be read.
+  // Read slices out of order
+  for (size_t slice : {2, 0, 3, 1}) {
+    REQUIRE(library.GetNumGenomes(slice) == slice_sizes[slice]);
+    dirdevo::ByteReader in(library.GetSliceReader(slice));
+    for (size_t i = 0; i < slice_sizes[slice]; ++i) {
+      const genome_t genome = org_t::ReadGenome(in, world);
+      for (size_t bit = 0; bit < org_t::GENOME_SIZE; ++bit) {
+        REQUIRE(genome.Get(bit) == slices[slice][i].Get(bit));
+      }
+    }
+    REQUIRE(in.AtEnd());
+  }
+  library.Close();
+  REQUIRE(!library.IsOpen());
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Genome library records what wrote it", "[genome_library]") {
+  const std::string path = "genome_library_tag_test.ddgl";
+  {
+    dirdevo::GenomeLibraryWriter<org_t> writer(path, 1, "onemax-64");
+    writer.StartSlice();
+    writer.AddGenome(genome_t(true));
+    REQUIRE(writer.Close());
+  }
+  dirdevo::GenomeLibrary library(path);
+  REQUIRE(library.IsOpen());
+  // Same tag, different genome size (or the other way around): the genomes can't be decoded.
+  REQUIRE(!library.Holds<dirdevo::OneMaxOrganism<256>>("onemax-64"));
+  REQUIRE(!library.Holds<dirdevo::OneMaxOrganism<256>>("onemax-256"));
+  REQUIRE(!library.Holds<org_t>("onemax-256"));
+  REQUIRE(library.Holds<org_t>("onemax-64"));
+  library.Close();
+  REQUIRE(library.GetTag().empty());
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Genome library rejects other files", "[genome_library]") {
+  dirdevo::GenomeLibrary library;
+  REQUIRE(!library.Open("this_file_does_not_exist.ddgl"));
+  REQUIRE(library.GetError().size());
+
+  const std::string path = "not_a_genome_library.ddgl";
+  {
+    std::ofstream file(path);
+    file << "this is not a genome library";
+  }
+  REQUIRE(!library.Open(path));
+  REQUIRE(!library.IsOpen());
+  std::remove(path.c_str());
+}
@@ -0,0 +1,76 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/max_coverage.hpp"
+
+namespace {
+
+/// Most tasks covered by any n profiles (exhaustive search).
+size_t brute_force_max_coverage(const emp::vector<dirdevo::task_mask_t>& profiles, size_t n) {
+  size_t best = 0;
+  const size_t num_subsets = (size_t)1 << profiles.size();
+  for (size_t subset = 0; subset < num_subsets; ++subset) {
+    if ((size_t)__builtin_popcountll(subset) > n) continue;
+    dirdevo::task_mask_t covered = 0;
+    for (size_t i = 0; i < profiles.size(); ++i) {
+      if (subset & ((size_t)1 << i)) covered |= profiles[i];
+    }
+    best = std::max(best, dirdevo::count_tasks(covered));
+  }
+  return best;
+}
+
+}
+
+TEST_CASE("Max coverage", "[max_coverage]") {
+  REQUIRE(dirdevo::coverage_to_string(0b1011, 6) == "110100");
+  REQUIRE(dirdevo::solve_max_coverage({}).empty());
+
+  {
+    // Nothing covered
+    const auto solutions = dirdevo::solve_max_coverage({0, 0, 0});
+    REQUIRE(solutions.size() == 3);
+    for (const auto& solution : solutions) REQUIRE(solution.GetCoverage() == 0);
+  }
+
+  {
+    // Greedy picks 0b0111 first, but 0b1100 + 0b0011 is better.
+    const emp::vector<dirdevo::task_mask_t> profiles = {0b0111, 0b1100, 0b0011, 0b0100};
+    const auto solutions = dirdevo::solve_max_coverage(profiles);
+    REQUIRE(solutions.size() == profiles.size());
+    REQUIRE(solutions[0].GetCoverage() == 3);
+    REQUIRE(solutions[1].GetCoverage() == 4);
+    REQUIRE(solutions[1].covered == 0b1111);
+    REQUIRE(solutions[3].num_profiles == 4);
+    REQUIRE(solutions[3].GetCoverage() == 4);
+  }
+
+  // Random instances: coverage matches an exhaustive search, and the chosen profiles give that coverage.
+  emp::Random random(3);
+  for (size_t trial = 0; trial < 200; ++trial) {
+    const size_t num_profiles = 1 + random.GetUInt(12);
+    const size_t num_tasks = 1 + random.GetUInt(dirdevo::MAX_COVERAGE_TASKS);
+    const double p = random.GetDouble(0.02, 0.4);
+    emp::vector<dirdevo::task_mask_t> profiles(num_profiles, 0);
+    for (auto& profile : profiles) {
+      for (size_t task = 0; task < num_tasks; ++task) {
+        if (random.P(p)) profile |= ((dirdevo::task_mask_t)1 << task);
+      }
+    }
+    const auto solutions = dirdevo::solve_max_coverage(profiles);
+    REQUIRE(solutions.size() == num_profiles);
+    for (size_t n = 1; n <= num_profiles; ++n) {
+      const auto& solution = solutions[n - 1];
+      REQUIRE(solution.num_profiles == n);
+      REQUIRE(solution.profiles.size() <= n);
+      dirdevo::task_mask_t covered = 0;
+      for (size_t profile : solution.profiles) covered |= profiles[profile];
+      REQUIRE(covered == solution.covered);
+      REQUIRE(solution.GetCoverage() == brute_force_max_coverage(profiles, n));
+    }
+  }
+}
@@ -121,4 +121,116 @@ TEST_CASE("Test dirdevo::find_pareto_front", "[utility][pareto][find_pareto_fron
     }
   }
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Test dirdevo::dominates_row", "[utility][pareto][dominates]") {
+  // Odd number of objectives to exercise any leftover (non-vectorized) comparisons.
+  emp::vector<double> a({1, 1, 1, 1, 1});
+  emp::vector<double> b({1, 1, 1, 1, 1});
+  CHECK(!dirdevo::dominates_row(a.data(), b.data(), a.size()));
+  b[4] = 0;
+  CHECK(dirdevo::dominates_row(a.data(), b.data(), a.size()));
+  CHECK(!dirdevo::dominates_row(b.data(), a.data(), a.size()));
+  b[0] = 2;
+  CHECK(!dirdevo::dominates_row(a.data(), b.data(), a.size()));
+  CHECK(!dirdevo::dominates_row(b.data(), a.data(), a.size()));
+}
+
+TEST_CASE("Test dirdevo::find_pareto_front_fast", "[utility][pareto][find_pareto_front]") {
+  using set_t = std::unordered_set<size_t>;
+
+  emp::Random random(2);
+
+  // Duplicates are all part of the front (same as reference implementation).
+  emp::vector< emp::vector<double> > score_table({
+    {1, 0},
+    {0, 1},
+    {1, 0},
+    {0, 0}
+  });
+  emp::vector<size_t> front = dirdevo::find_pareto_front_fast(dirdevo::ScoreMatrix(score_table));
+  CHECK(front == emp::vector<size_t>({0, 1, 2}));
+
+  // Compare against the reference implementation on random tables (with lots of ties and without).
+  for (size_t num_objs : emp::vector<size_t>({1, 2, 3, 4, 7, 10})) {
+    for (size_t trial_i = 0; trial_i < 50; ++trial_i) {
+      const size_t num_candidates = 1 + random.GetUInt(300);
+      const bool discrete = trial_i % 2;
+      emp::vector< emp::vector<double> > trial_table(num_candidates, emp::vector<double>(num_objs));
+      for (auto& row : trial_table) {
+        for (auto& score : row) {
+          score = (discrete) ? (double)random.GetUInt(4) : random.GetDouble();
+        }
+      }
+      const auto reference_front = dirdevo::find_pareto_front(trial_table);
+      const auto fast_front = dirdevo::find_pareto_front_fast(dirdevo::ScoreMatrix(trial_table));
+      CHECK(std::is_sorted(fast_front.begin(), fast_front.end()));
+      CHECK(set_t(fast_front.begin(), fast_front.end()) == set_t(reference_front.begin(), reference_front.end()));
+      CHECK(fast_front.size() == reference_front.size());
+    }
+  }
+}
+
+TEST_CASE("Test dirdevo::non_dominated_sort", "[utility][pareto][non_dominated_sort]") {
+  using set_t = std::unordered_set<size_t>;
+
+  emp::Random random(2);
+
+  emp::vector< emp::vector<size_t> > fronts;
+  emp::vector<size_t> ranks;
+
+  // Three nested fronts
+  dirdevo::ScoreMatrix scores(emp::vector< emp::vector<double> >({
+    {0, 0},
+    {2, 0},
+    {1, 1},
+    {0, 2},
+    {3, 3},
+    {1, 0}
+  }));
+  dirdevo::non_dominated_sort(scores, fronts, ranks);
+  REQUIRE(fronts.size() == 4);
+  CHECK(fronts[0] == emp::vector<size_t>({4}));
+  CHECK(fronts[1] == emp::vector<size_t>({1, 2, 3}));
+  CHECK(fronts[2] == emp::vector<size_t>({5}));
+  CHECK(fronts[3] == emp::vector<size_t>({0}));
+  CHECK(ranks == emp::vector<size_t>({3, 1, 1, 1, 0, 2}));
+
+  // Crowding distances: extremes are infinite, middle is normalized distance between neighbors (on each objective).
+  emp::vector<double> crowding(scores.GetNumRows(), 0.0);
+  dirdevo::crowding_distances(scores, fronts[1], crowding);
+  CHECK(crowding[1] == std::numeric_limits<double>::infinity());
+  CHECK(crowding[3] == std::numeric_limits<double>::infinity());
+  CHECK(crowding[2] == Approx(2.0));
+
+  // Compare against repeatedly peeling off the pareto front with the reference implementation.
+  for (size_t num_objs : emp::vector<size_t>({1, 2, 3, 5})) {
+    for (size_t trial_i = 0; trial_i < 20; ++trial_i) {
+      const size_t num_candidates = 1 + random.GetUInt(200);
+      emp::vector< emp::vector<double> > table(num_candidates, emp::vector<double>(num_objs));
+      for (auto& row : table) {
+        for (auto& score : row) score = (double)random.GetUInt(5);
+      }
+      dirdevo::non_dominated_sort(dirdevo::ScoreMatrix(table), fronts, ranks);
+
+      emp::vector<size_t> remaining(num_candidates);
+      std::iota(remaining.begin(), remaining.end(), 0);
+      size_t front_i = 0;
+      while (remaining.size()) {
+        emp::vector< emp::vector<double> > remaining_table;
+        for (size_t id : remaining) remaining_table.emplace_back(table[id]);
+        set_t expected_front;
+        for (size_t i : dirdevo::find_pareto_front(remaining_table)) expected_front.insert(remaining[i]);
+        REQUIRE(front_i < fronts.size());
+        CHECK(set_t(fronts[front_i].begin(), fronts[front_i].end()) == expected_front);
+        for (size_t id : expected_front) CHECK(ranks[id] == front_i);
+        remaining.erase(
+          std::remove_if(remaining.begin(), remaining.end(), [&expected_front](size_t id) { return expected_front.count(id); }),
+          remaining.end()
+        );
+        ++front_i;
+      }
+      CHECK(fronts.size() == front_i);
+    }
+  }
+}
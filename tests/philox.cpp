@@ -0,0 +1,64 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <unordered_set>
+
+#include "dirdevo/utility/Philox.hpp"
+
+TEST_CASE("Philox4x32-10 known answers", "[philox]") {
+  // Known-answer vectors from the Random123 distribution (kat_vectors)
+  REQUIRE(
+    dirdevo::philox4x32_10({0, 0, 0, 0}, {0, 0})
+    == dirdevo::philox_counter_t({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8})
+  );
+  REQUIRE(
+    dirdevo::philox4x32_10({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff})
+    == dirdevo::philox_counter_t({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd})
+  );
+  REQUIRE(
+    dirdevo::philox4x32_10({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0})
+    == dirdevo::philox_counter_t({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1})
+  );
+}
+
+TEST_CASE("Stream seeds", "[philox]") {
+  // Same stream => same seed
+  REQUIRE(dirdevo::stream_seed(42, 3, 7, 1) == dirdevo::stream_seed(42, 3, 7, 1));
+  // Seeds are valid (positive) emp::Random seeds, and streams that differ in any field get different seeds
+  std::unordered_set<int> seeds;
+  for (uint64_t key = 0; key < 4; ++key) {
+    for (uint32_t id = 0; id < 16; ++id) {
+      for (uint32_t epoch = 0; epoch < 16; ++epoch) {
+        for (uint32_t purpose = 0; purpose < 2; ++purpose) {
+          const int seed = dirdevo::stream_seed(key << 32, id, epoch, purpose);
+          REQUIRE(seed > 0);
+          seeds.emplace(seed);
+        }
+      }
+    }
+  }
+  REQUIRE(seeds.size() == 4 * 16 * 16 * 2);
+}
+
+TEST_CASE("Unique stream seeds", "[philox]") {
+  // The first candidate seed is the stream's seed.
+  const auto seeds = dirdevo::unique_stream_seeds(42, 100, 3, 1);
+  REQUIRE(seeds.size() == 100);
+  for (uint32_t id = 0; id < seeds.size(); ++id) {
+    REQUIRE(dirdevo::stream_seed(42, id, 3, 1, 0) == dirdevo::stream_seed(42, id, 3, 1));
+  }
+  REQUIRE(seeds[0] == dirdevo::stream_seed(42, 0, 3, 1));
+  // Enough ids that 31-bit seeds are all but certain to collide (~10 expected collisions); seeds are still unique.
+  const uint32_t num_ids = 200000;
+  const auto many_seeds = dirdevo::unique_stream_seeds(7, num_ids, 0, 1);
+  size_t num_redrawn = 0;
+  for (uint32_t id = 0; id < num_ids; ++id) {
+    REQUIRE(many_seeds[id] > 0);
+    num_redrawn += (size_t)(many_seeds[id] != dirdevo::stream_seed(7, id, 0, 1));
+  }
+  REQUIRE(std::unordered_set<int>(many_seeds.begin(), many_seeds.end()).size() == num_ids);
+  REQUIRE(num_redrawn > 0);
+  // Same seeds no matter how many times they're computed.
+  REQUIRE(dirdevo::unique_stream_seeds(7, num_ids, 0, 1) == many_seeds);
+}
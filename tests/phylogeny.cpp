@@ -0,0 +1,251 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+
+#include "emp/base/Ptr.hpp"
+#include "emp/base/vector.hpp"
+#include "emp/Evolve/Systematics.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/CsvReader.hpp"
+#include "dirdevo/utility/GenotypeFingerprint.hpp"
+#include "dirdevo/utility/PairwiseDistanceSampler.hpp"
+#include "dirdevo/utility/PhylogenyEventLog.hpp"
+
+namespace {
+
+/// Just enough of an organism to fingerprint
+struct TestOrg {
+  using genome_t = emp::vector<uint32_t>;
+
+  static void WriteGenome(const genome_t& genome, dirdevo::ByteWriter& out) {
+    out.Write<uint64_t>(genome.size());
+    for (uint32_t site : genome) out.Write<uint32_t>(site);
+  }
+};
+
+/// Just enough of a taxon (and of a systematics manager) for the distance sampler
+struct TestTaxon {
+  size_t id;
+  emp::Ptr<TestTaxon> parent;
+
+  size_t GetID() const { return id; }
+  emp::Ptr<TestTaxon> GetParent() const { return parent; }
+};
+
+struct TestSystematics {
+  using taxon_t = TestTaxon;
+  emp::vector< emp::Ptr<taxon_t> > active;
+
+  const emp::vector< emp::Ptr<taxon_t> >& GetActive() const { return active; }
+};
+
+using sampler_t = dirdevo::PairwiseDistanceSampler<TestSystematics>;
+
+/// Organisms are just their genomes (taxa are keyed by genome).
+using systematics_t = emp::Systematics<int, int>;
+using event_log_t = dirdevo::PhylogenyEventLog<systematics_t, int>;
+
+/// Read the given columns of every row of a .csv file.
+emp::vector<emp::vector<std::string>> read_csv(const std::string& path, const emp::vector<std::string>& names) {
+  dirdevo::CsvReader reader(path);
+  REQUIRE(reader.IsOpen());
+  std::string missing;
+  const emp::vector<size_t> columns = reader.GetColumns(names, missing);
+  REQUIRE(missing.empty());
+  emp::vector<emp::vector<std::string>> rows;
+  reader.ForEachRow(columns, [&rows](const dirdevo::CsvReader::Row& row) {
+    rows.emplace_back();
+    for (size_t i = 0; i < row.GetNumFields(); ++i) rows.back().emplace_back(row[i]);
+  });
+  return rows;
+}
+
+/// Phylogeny snapshot (id, ancestor_list, origin_time, destruction_time) as a set of rows. Times are parsed (so that
+/// formatting differences, e.g., 5 vs. 5.0, don't matter).
+std::set<std::string> read_snapshot(const std::string& path) {
+  dirdevo::CsvReader reader(path);
+  REQUIRE(reader.IsOpen());
+  std::string missing;
+  const emp::vector<size_t> columns = reader.GetColumns({"id", "ancestor_list", "origin_time", "destruction_time"}, missing);
+  REQUIRE(missing.empty());
+  std::set<std::string> rows;
+  reader.ForEachRow(columns, [&rows](const dirdevo::CsvReader::Row& row) {
+    double origin_time = 0;
+    double destruction_time = 0;
+    REQUIRE(row.Get(2, origin_time));
+    REQUIRE(row.Get(3, destruction_time));
+    rows.emplace(
+      std::string(row[0]) + "|" + std::string(row[1]) + "|" + std::to_string(origin_time) + "|" + std::to_string(destruction_time)
+    );
+  });
+  return rows;
+}
+
+}
+
+TEST_CASE("Genotype fingerprints", "[phylogeny]") {
+  const TestOrg::genome_t genome_a({1, 2, 3, 4});
+  const TestOrg::genome_t genome_b({1, 2, 3, 5});
+  const TestOrg::genome_t genome_c({1, 2, 3});
+
+  REQUIRE(dirdevo::genotype_fingerprint<TestOrg>(genome_a) == dirdevo::genotype_fingerprint<TestOrg>(TestOrg::genome_t(genome_a)));
+  REQUIRE(dirdevo::genotype_fingerprint<TestOrg>(genome_a) != dirdevo::genotype_fingerprint<TestOrg>(genome_b));
+  REQUIRE(dirdevo::genotype_fingerprint<TestOrg>(genome_a) != dirdevo::genotype_fingerprint<TestOrg>(genome_c));
+
+  // Published FNV-1a test vectors (fingerprints must not depend on the standard library)
+  REQUIRE(dirdevo::fnv1a_64("", 0) == 0xcbf29ce484222325ull);
+  REQUIRE(dirdevo::fnv1a_64("a", 1) == 0xaf63dc4c8601ec8cull);
+  REQUIRE(dirdevo::fnv1a_64("foobar", 6) == 0x85944171f73967e8ull);
+}
+
+TEST_CASE("Pairwise distance sampling", "[phylogeny]") {
+  // Tree:  0 -> 1 -> 3 -> 4
+  //          -> 2
+  // plus an unrelated root (5)
+  emp::vector< emp::Ptr<TestTaxon> > taxa;
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{0, nullptr}));
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{1, taxa[0]}));
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{2, taxa[0]}));
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{3, taxa[1]}));
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{4, taxa[3]}));
+  taxa.emplace_back(emp::NewPtr<TestTaxon>(TestTaxon{5, nullptr}));
+
+  sampler_t sampler(1, 100);
+
+  SECTION("Branch distances") {
+    REQUIRE(sampler.BranchDistance(taxa[4], taxa[4]) == 0);
+    REQUIRE(sampler.BranchDistance(taxa[4], taxa[3]) == 1);
+    REQUIRE(sampler.BranchDistance(taxa[3], taxa[4]) == 1);
+    REQUIRE(sampler.BranchDistance(taxa[4], taxa[2]) == 4);
+    REQUIRE(sampler.BranchDistance(taxa[2], taxa[1]) == 2);
+    REQUIRE(sampler.BranchDistance(taxa[4], taxa[5]) == -1);
+  }
+
+  SECTION("Samples are pairs of distinct active taxa") {
+    TestSystematics sys;
+    sys.active = {taxa[4], taxa[2], taxa[1]};
+    const auto& distances = sampler.Sample(sys);
+    REQUIRE(distances.size() == sampler.GetNumSamples());
+    for (double dist : distances) {
+      REQUIRE(((dist == 1) || (dist == 2) || (dist == 4)));
+    }
+  }
+
+  SECTION("Unrelated pairs are skipped") {
+    TestSystematics sys;
+    sys.active = {taxa[2], taxa[5]};
+    REQUIRE(sampler.Sample(sys).empty());
+    sys.active = {taxa[5]};
+    REQUIRE(sampler.Sample(sys).empty());
+  }
+
+  SECTION("Samples don't depend on the order of active taxa") {
+    TestSystematics sys1;
+    sys1.active = {taxa[4], taxa[2], taxa[1], taxa[0]};
+    TestSystematics sys2;
+    sys2.active = {taxa[0], taxa[1], taxa[4], taxa[2]};
+    sampler_t sampler1(5, 50);
+    sampler_t sampler2(5, 50);
+    REQUIRE(sampler1.Sample(sys1) == sampler2.Sample(sys2));
+  }
+
+  for (auto taxon : taxa) taxon.Delete();
+}
+
+TEST_CASE("Phylogeny event log", "[phylogeny]") {
+  const std::string log_path = "phylogeny_events_test.csv";
+  {
+    systematics_t systematics([](const int& genome) { return genome; }, true, true, false, true);
+    event_log_t log;  // Destroyed before the systematics manager
+    log.Attach(systematics);
+
+    // Events from before the log file is opened are kept.
+    int ancestor = 0;
+    systematics.AddOrg(ancestor, {0, 0}, 0);
+    log.Open(log_path);
+
+    // A new taxon (1) that goes extinct (and is pruned) before the log is flushed: its fields are read before the taxon
+    // is deleted.
+    int mutant = 1;
+    systematics.SetNextParent(0);
+    systematics.AddOrg(mutant, {1, 0}, 1);
+    int clone = 0;
+    systematics.RemoveOrgAfterRepro({1, 0}, 2);
+    systematics.SetNextParent(0);
+    systematics.AddOrg(clone, {1, 0}, 2);
+    log.MarkEpoch(0, 2);
+  }
+
+  using row_t = emp::vector<std::string>;
+  const auto events = read_csv(log_path, {"event", "id", "parent_id", "time"});
+  REQUIRE(events.size() == 5);
+  const std::string ancestor_id = events[0][1];
+  const std::string mutant_id = events[1][1];
+  REQUIRE(mutant_id != ancestor_id);
+  REQUIRE(events[0] == row_t({"new", ancestor_id, "-1", "0"}));
+  REQUIRE(events[1] == row_t({"new", mutant_id, ancestor_id, "1"}));
+  REQUIRE(events[2] == row_t({"extinct", mutant_id, "", "2"}));
+  REQUIRE(events[3] == row_t({"prune", mutant_id, "", ""}));
+  REQUIRE(events[4] == row_t({"epoch", "0", "", "2"}));
+  std::remove(log_path.c_str());
+}
+
+TEST_CASE("Phylogeny snapshots rebuilt from the event log", "[phylogeny]") {
+  // Evolve a small population, writing both an event log and (at the end of every epoch) a full snapshot. Replaying
+  // the log (with scripts/reconstruct_phylogeny.py) must rebuild each snapshot.
+  const std::string log_path = "phylogeny_events_rebuild_test.csv";
+  const size_t pop_size = 16;
+  const size_t num_epochs = 6;
+  const size_t births_per_epoch = 40;
+  {
+    systematics_t systematics([](const int& genome) { return genome; }, true, true, false, true);
+    event_log_t log;
+    log.Attach(systematics);
+    log.Open(log_path);
+
+    emp::Random random(2);
+    emp::vector<bool> occupied(pop_size, false);
+    emp::vector<int> genomes(pop_size, 0);
+    int next_genome = 1;
+    occupied[0] = true;
+    systematics.AddOrg(genomes[0], {0, 0}, 0);
+    size_t time = 0;
+    for (size_t epoch = 0; epoch < num_epochs; ++epoch) {
+      for (size_t birth = 0; birth < births_per_epoch; ++birth) {
+        ++time;
+        size_t parent = random.GetUInt(pop_size);
+        while (!occupied[parent]) parent = random.GetUInt(pop_size);
+        size_t pos = random.GetUInt(pop_size);
+        while (pos == parent) pos = random.GetUInt(pop_size);
+        if (occupied[pos]) systematics.RemoveOrgAfterRepro({pos, 0}, (int)time);
+        genomes[pos] = (random.P(0.3)) ? next_genome++ : genomes[parent];
+        occupied[pos] = true;
+        systematics.SetNextParent(parent);
+        systematics.AddOrg(genomes[pos], {pos, 0}, (int)time);
+      }
+      log.MarkEpoch(epoch, time);
+      systematics.Snapshot("phylogeny_snapshot_test_" + std::to_string(epoch) + ".csv");
+    }
+  }
+
+  for (size_t epoch = 0; epoch < num_epochs; ++epoch) {
+    const std::string snapshot_path = "phylogeny_snapshot_test_" + std::to_string(epoch) + ".csv";
+    const std::string rebuilt_path = "phylogeny_rebuilt_test_" + std::to_string(epoch) + ".csv";
+    const std::string cmd = "python3 ../scripts/reconstruct_phylogeny.py " + log_path
+      + " --epoch " + std::to_string(epoch) + " --output " + rebuilt_path + " > /dev/null";
+    REQUIRE(std::system(cmd.c_str()) == 0);
+    const std::set<std::string> snapshot = read_snapshot(snapshot_path);
+    REQUIRE(snapshot.size() > 1);
+    REQUIRE(read_snapshot(rebuilt_path) == snapshot);
+    std::remove(snapshot_path.c_str());
+    std::remove(rebuilt_path.c_str());
+  }
+  std::remove(log_path.c_str());
+}
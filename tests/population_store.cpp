@@ -0,0 +1,132 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/PopulationStore.hpp"
+
+namespace {
+
+struct TestOrg {
+  size_t id;
+  emp::vector<size_t> data; // Make sure organisms with heap-allocated members move correctly.
+  TestOrg(size_t i) : id(i), data(4, i) { }
+};
+
+using store_t = dirdevo::PopulationStore<TestOrg>;
+
+/// Check that occupancy bookkeeping agrees with itself.
+void CheckStore(const store_t& store) {
+  size_t occupied = 0;
+  for (size_t cell = 0; cell < store.GetSize(); ++cell) {
+    if (store.IsOccupied(cell)) {
+      ++occupied;
+      REQUIRE(store.GetOrg(cell).data == emp::vector<size_t>(4, store.GetOrg(cell).id));
+    }
+  }
+  REQUIRE(occupied == store.GetNumOrgs());
+  std::unordered_set<size_t> occupied_cells;
+  for (size_t i = 0; i < store.GetNumOrgs(); ++i) {
+    REQUIRE(store.IsOccupied(store.GetOccupiedCell(i)));
+    occupied_cells.emplace(store.GetOccupiedCell(i));
+  }
+  REQUIRE(occupied_cells.size() == store.GetNumOrgs());
+}
+
+}
+
+TEST_CASE("PopulationStore placement and removal", "[utility][PopulationStore]")
+{
+  emp::Random random(1);
+  store_t store;
+  store.SetMixed(100);
+  REQUIRE(store.GetSize() == 100);
+  REQUIRE(store.GetNumOrgs() == 0);
+  REQUIRE(store.GetNeighborhoodSize() == 0);
+
+  emp::vector<int> reference(100, -1); // Organism id in each cell (-1 if empty)
+  for (size_t i = 0; i < 5000; ++i) {
+    const size_t cell = random.GetUInt(store.GetSize());
+    if (store.IsOccupied(cell) && random.P(0.5)) {
+      store.Remove(cell);
+      reference[cell] = -1;
+    } else if (!store.IsOccupied(cell)) {
+      store.Place(cell, TestOrg(i));
+      reference[cell] = (int)i;
+    } else {
+      const size_t other = random.GetUInt(store.GetSize());
+      store.Swap(cell, other);
+      std::swap(reference[cell], reference[other]);
+    }
+    for (size_t c = 0; c < store.GetSize(); ++c) {
+      REQUIRE(store.IsOccupied(c) == (reference[c] != -1));
+      if (reference[c] != -1) REQUIRE(store.GetOrg(c).id == (size_t)reference[c]);
+    }
+    REQUIRE(store.GetNumOrgs() == (size_t)(100 - std::count(reference.begin(), reference.end(), -1)));
+    CheckStore(store);
+    if (store.GetNumOrgs()) REQUIRE(store.IsOccupied(store.GetRandomOrgID(random)));
+    if (store.GetNumOrgs() < store.GetSize()) REQUIRE(!store.IsOccupied(store.GetRandomEmptyCellID(random)));
+  }
+
+  store.Clear();
+  REQUIRE(store.GetNumOrgs() == 0);
+  CheckStore(store);
+}
+
+TEST_CASE("PopulationStore grid neighborhoods", "[utility][PopulationStore]")
+{
+  emp::Random random(2);
+  store_t store;
+
+  // 2D toroidal grid: 9-cell (Moore + self) neighborhoods
+  const size_t width = 5;
+  const size_t height = 4;
+  store.SetGrid(width, height);
+  REQUIRE(store.GetSize() == width * height);
+  REQUIRE(store.GetNeighborhoodSize() == 9);
+  for (size_t cell = 0; cell < store.GetSize(); ++cell) {
+    std::unordered_set<size_t> expected;
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        const size_t x = (size_t)(((int)(cell % width) + dx + (int)width) % (int)width);
+        const size_t y = (size_t)(((int)(cell / width) + dy + (int)height) % (int)height);
+        expected.emplace(x + y * width);
+      }
+    }
+    std::unordered_set<size_t> found;
+    for (size_t i = 0; i < 9; ++i) found.emplace(store.GetNeighbor(cell, i));
+    REQUIRE(found == expected);
+    for (size_t i = 0; i < 20; ++i) REQUIRE(expected.count(store.GetRandomNeighbor(cell, random)));
+  }
+  // Neighbor 4 (dx = 0, dy = 0) is the cell itself.
+  REQUIRE(store.GetNeighbor(7, 4) == 7);
+  // Neighbor 0 (dx = -1, dy = -1) wraps around.
+  REQUIRE(store.GetNeighbor(0, 0) == (width - 1) + (height - 1) * width);
+
+  // 3D toroidal grid: 27-cell neighborhoods
+  const size_t depth = 3;
+  store.SetGrid3D(width, height, depth);
+  REQUIRE(store.GetSize() == width * height * depth);
+  REQUIRE(store.GetNeighborhoodSize() == 27);
+  for (size_t cell = 0; cell < store.GetSize(); ++cell) {
+    std::unordered_set<size_t> found;
+    for (size_t i = 0; i < 27; ++i) found.emplace(store.GetNeighbor(cell, i));
+    REQUIRE(found.size() == 27);
+    REQUIRE(store.GetNeighbor(cell, 13) == cell);
+  }
+  // Reconfiguring clears the population (even if the shape, and so the neighbor table, doesn't change)
+  store.Place(3, TestOrg(3));
+  store.SetGrid3D(width, height, depth);
+  REQUIRE(store.GetNumOrgs() == 0);
+  REQUIRE(!store.IsOccupied(3));
+  REQUIRE(store.GetNeighbor(0, 13) == 0);
+  store.Place(3, TestOrg(3));
+  store.SetMixed(10);
+  REQUIRE(store.GetNumOrgs() == 0);
+  REQUIRE(store.GetNeighborhoodSize() == 0);
+}
@@ -0,0 +1,100 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <cmath>
+#include <numeric>
+
+#include "emp/base/vector.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/utility/ProbabilisticScheduler.hpp"
+
+namespace {
+
+/// Check that the scheduler's weights (and total) match the expected weights.
+void CheckWeights(dirdevo::ProbabilisticScheduler& scheduler, const emp::vector<double>& weights) {
+  REQUIRE(scheduler.GetNumItems() == weights.size());
+  for (size_t i = 0; i < weights.size(); ++i) {
+    REQUIRE(scheduler.GetWeight(i) == weights[i]);
+  }
+  const double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+  REQUIRE(std::abs(scheduler.GetWeight() - total) < 1e-9 * (1.0 + total));
+}
+
+}
+
+TEST_CASE("ProbabilisticScheduler weight bookkeeping", "[utility]") {
+  emp::Random random(2);
+  for (size_t num_items : emp::vector<size_t>({1, 7, 64, 100})) {
+    dirdevo::ProbabilisticScheduler scheduler(random, num_items);
+    emp::vector<double> weights(num_items, 0.0);
+    CheckWeights(scheduler, weights);
+
+    // Immediate adjustments
+    for (size_t i = 0; i < 200; ++i) {
+      const size_t id = random.GetUInt(num_items);
+      weights[id] = random.GetDouble(0, 10);
+      scheduler.AdjustWeight(id, weights[id]);
+      CheckWeights(scheduler, weights);
+    }
+
+    // Deferred adjustments (and swaps) are summed on the next refresh
+    for (size_t round = 0; round < 20; ++round) {
+      scheduler.DeferWeightRefresh();
+      for (size_t i = 0; i < 5; ++i) {
+        const size_t id = random.GetUInt(num_items);
+        weights[id] = random.GetDouble(0, 10);
+        scheduler.AdjustWeight(id, weights[id]);
+        const size_t id1 = random.GetUInt(num_items);
+        const size_t id2 = random.GetUInt(num_items);
+        std::swap(weights[id1], weights[id2]);
+        scheduler.SwapWeights(id1, id2);
+      }
+      CheckWeights(scheduler, weights);
+    }
+
+    // Bulk load
+    for (double& weight : weights) weight = random.GetDouble(0, 10);
+    scheduler.LoadWeights(weights);
+    CheckWeights(scheduler, weights);
+
+    // Clear
+    scheduler.ClearWeights();
+    std::fill(weights.begin(), weights.end(), 0.0);
+    CheckWeights(scheduler, weights);
+  }
+}
+
+TEST_CASE("ProbabilisticScheduler draws proportionally to weight", "[utility]") {
+  emp::Random random(3);
+  const size_t num_items = 10;
+  dirdevo::ProbabilisticScheduler scheduler(random, num_items);
+  // Only odd items have weight (item i has weight i).
+  emp::vector<double> weights(num_items, 0.0);
+  for (size_t i = 1; i < num_items; i += 2) weights[i] = (double)i;
+  scheduler.LoadWeights(weights);
+  const double total = scheduler.GetWeight();
+
+  const size_t num_draws = 100000;
+  emp::vector<size_t> counts(num_items, 0);
+  for (size_t draw = 0; draw < num_draws; ++draw) ++counts[scheduler.GetRandom()];
+  for (size_t i = 0; i < num_items; ++i) {
+    if (weights[i] == 0) {
+      REQUIRE(counts[i] == 0);
+    } else {
+      const double expected = weights[i] / total;
+      REQUIRE(std::abs((double)counts[i] / num_draws - expected) < 0.01);
+    }
+  }
+
+  // Zero-weight items are never drawn, even right after a deferred change.
+  scheduler.DeferWeightRefresh();
+  scheduler.AdjustWeight(9, 0);
+  scheduler.AdjustWeight(0, 5);
+  for (size_t draw = 0; draw < 1000; ++draw) {
+    const size_t id = scheduler.GetRandom();
+    REQUIRE(id != 9);
+    REQUIRE((id % 2 == 1 || id == 0));
+  }
+}
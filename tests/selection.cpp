@@ -2,6 +2,8 @@
 
 #include "Catch/single_include/catch2/catch.hpp"
 
+#include <algorithm>
+#include <map>
 #include <unordered_set>
 
 #include "emp/datastructs/vector_utils.hpp"
@@ -11,14 +13,60 @@
 #include "dirdevo/selection/NonDominatedElite.hpp"
 #include "dirdevo/selection/Tournament.hpp"
 #include "dirdevo/selection/NonDominatedTournament.hpp"
+#include "dirdevo/selection/NonDominatedSorting.hpp"
+
+TEST_CASE("Test EliteSelection", "[selection][elite]") {
+  // Reference implementation: rank everything with a multimap (the original elite implementation).
+  auto reference_elite = [](const emp::vector<double>& scores, size_t elite_count, size_t n) {
+    std::multimap<double, size_t> fit_map;
+    for (size_t id = 0; id < scores.size(); ++id) fit_map.insert(std::make_pair(scores[id], id));
+    emp::vector<size_t> elites;
+    for (auto m = fit_map.rbegin(); elites.size() < elite_count; ++m) elites.emplace_back(m->second);
+    emp::vector<size_t> result;
+    for (size_t i = 0; i < n; ++i) result.emplace_back(elites[i % elite_count]);
+    return result;
+  };
 
-TEST_CASE("Test NonDominatedTournamentSelection", "[selection][ndt]") {
-  using score_fun_t = std::function<double(void)>;
+  emp::Random random(1);
+  emp::vector<double> scores(100);
+  dirdevo::EliteSelect elite(scores, 1);
+  for (size_t elite_count : {1, 3, 10, 100}) {
+    // Small integer scores, so there are lots of ties.
+    for (double& score : scores) score = random.GetUInt(8);
+    elite.elite_count = elite_count;
+    CHECK(elite(250) == reference_elite(scores, elite_count, 250));
+  }
+
+  scores = {/*0:*/ 8, /*1:*/ 128, /*2:*/ 2, /*3:*/ 32, /*4:*/ 16, /*5:*/ 4};
+  elite.elite_count = 3;
+  CHECK(elite(6) == emp::vector<size_t>({1, 3, 4, 1, 3, 4}));
+}
+
+TEST_CASE("Test TournamentSelection", "[selection][tournament]") {
+  emp::vector<double> scores{/*0:*/ 8, /*1:*/ 128, /*2:*/ 2, /*3:*/ 32, /*4:*/ 16, /*5:*/ 4};
+  emp::Random random(1);
+  emp::Random ref_random(1);
+  dirdevo::TournamentSelect tournament(scores, random, 3);
+  const auto& selected = tournament(100);
+  // Each winner must be the best of its tournament (entrants drawn one tournament at a time).
+  for (size_t t = 0; t < selected.size(); ++t) {
+    size_t best_id = ref_random.GetUInt(scores.size());
+    for (size_t i = 1; i < 3; ++i) {
+      const size_t entry_id = ref_random.GetUInt(scores.size());
+      if (scores[entry_id] > scores[best_id]) best_id = entry_id;
+    }
+    CHECK(selected[t] == best_id);
+  }
+  // Tournaments as large as the population (with replacement) should mostly pick the best.
+  dirdevo::TournamentSelect big_tournament(scores, random, 6);
+  const auto& big_selected = big_tournament(1000);
+  CHECK(std::count(big_selected.begin(), big_selected.end(), (size_t)1) > 500);
+}
 
+TEST_CASE("Test NonDominatedTournamentSelection", "[selection][ndt]") {
   constexpr size_t seed = 2;
 
-  emp::vector< emp::vector<score_fun_t> > score_fun_sets;
-  emp::vector< emp::vector<double> > scores{
+  dirdevo::ScoreMatrix scores({
     /* 0= */ {1.0, 1.0, 1.0},
     /* 1= */ {1.0, 0.0, 0.0},
     /* 2= */ {0.0, 1.0, 0.0},
@@ -27,20 +75,12 @@ TEST_CASE("Test NonDominatedTournamentSelection", "[selection][ndt]") {
     /* 5= */ {0.0, 2.0, 0.0},
     /* 6= */ {2.0, 0.0, 0.0},
     /* 7= */ {0.0, 0.0, 2.0}
-  };
-  for (size_t i = 0; i < scores.size(); ++i) {
-    score_fun_sets.emplace_back();
-    for (size_t j = 0; j < scores[i].size(); ++j) {
-      score_fun_sets[i].emplace_back(
-        [i,j,&scores](){return scores[i][j];}
-      );
-    }
-  }
+  });
 
   emp::Random random(seed);
 
   dirdevo::NonDominatedTournamentSelect ndt_4(
-    score_fun_sets,
+    scores,
     random,
     8
   );
@@ -50,6 +90,86 @@ TEST_CASE("Test NonDominatedTournamentSelection", "[selection][ndt]") {
 
 }
 
+TEST_CASE("Test NonDominatedSortingSelection", "[selection][nds]") {
+  dirdevo::ScoreMatrix scores({
+    /* 0= */ {0.0, 0.0},
+    /* 1= */ {1.0, 0.0},
+    /* 2= */ {0.0, 1.0},
+    /* 3= */ {2.0, 2.0}
+  });
+
+  emp::Random random(2);
+
+  // Huge tournaments: (effectively) always pick the candidate in the first front.
+  dirdevo::NonDominatedSortingSelect nds(scores, random, 64);
+  const auto& selected = nds(10);
+  CHECK(selected == emp::vector<size_t>(10, 3));
+  CHECK(nds.GetRanks() == emp::vector<size_t>({2, 1, 1, 0}));
+
+  // Now 1 and 2 share the first front (with infinite crowding distance); 0 should never win.
+  scores(3, 0) = 0.0;
+  scores(3, 1) = 0.0;
+  const auto& selected2 = nds(100);
+  CHECK(nds.GetFronts().size() == 2);
+  CHECK(!emp::Has(selected2, (size_t)0));
+  CHECK(!emp::Has(selected2, (size_t)3));
+}
+
+TEST_CASE("Test LexicaseSelection", "[selection][lexicase]") {
+  // Reference implementation: filter copies of the candidate pool (the original lexicase implementation).
+  auto reference_lexicase = [](const dirdevo::ScoreMatrix& table, emp::Random& random, emp::vector<size_t>& fun_ordering, size_t n) {
+    emp::vector<size_t> result;
+    for (size_t sel_i = 0; sel_i < n; ++sel_i) {
+      emp::Shuffle(random, fun_ordering);
+      emp::vector<size_t> cur_pool(table.GetNumRows());
+      std::iota(cur_pool.begin(), cur_pool.end(), 0);
+      emp::vector<size_t> next_pool;
+      for (size_t fun_id : fun_ordering) {
+        double max_score = table(cur_pool[0], fun_id);
+        for (size_t cand_id : cur_pool) max_score = std::max(max_score, table(cand_id, fun_id));
+        for (size_t cand_id : cur_pool) {
+          if (table(cand_id, fun_id) == max_score) next_pool.emplace_back(cand_id);
+        }
+        std::swap(cur_pool, next_pool);
+        next_pool.clear();
+        if (cur_pool.size() == 1) break;
+      }
+      result.emplace_back(cur_pool[random.GetUInt(cur_pool.size())]);
+    }
+    return result;
+  };
+
+  emp::Random score_random(1);
+  for (size_t num_candidates : {1, 7, 64, 200}) {
+    dirdevo::ScoreMatrix scores(num_candidates, 6);
+    for (double& score : scores.GetData()) score = score_random.GetUInt(4);
+    emp::Random random(2);
+    emp::Random ref_random(2);
+    emp::vector<size_t> ref_ordering(6);
+    std::iota(ref_ordering.begin(), ref_ordering.end(), 0);
+    dirdevo::LexicaseSelect lex(scores, random);
+    for (size_t epoch = 0; epoch < 3; ++epoch) {
+      CHECK(lex(50) == reference_lexicase(scores, ref_random, ref_ordering, 50));
+      // Change the scores between selection events.
+      for (size_t i = 0; i < num_candidates; ++i) scores(i, epoch) = score_random.GetUInt(4);
+    }
+  }
+
+  // Epsilon lexicase: within epsilon of the best counts as the best.
+  dirdevo::ScoreMatrix scores({
+    /* 0= */ {10.0, 0.0},
+    /* 1= */ {9.5, 5.0},
+    /* 2= */ {0.0, 1.0}
+  });
+  emp::Random random(3);
+  dirdevo::LexicaseSelect lex(scores, random);
+  const auto plain = lex(200);
+  CHECK(emp::Has(plain, (size_t)0));
+  CHECK(emp::Has(plain, (size_t)1));
+  dirdevo::LexicaseSelect eps_lex(scores, random, 1.0);
+  CHECK(eps_lex(200) == emp::vector<size_t>(200, 1));
+}
+
 // TEST_CASE("Test Elite Selection", "[selection][elite]")
 // {
 //   // Create some scores
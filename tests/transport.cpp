@@ -0,0 +1,66 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include "emp/base/vector.hpp"
+
+#include "dirdevo/utility/ByteBuffer.hpp"
+#include "dirdevo/distributed/LocalTransport.hpp"
+#include "dirdevo/distributed/UnixSocketTransport.hpp"
+
+TEST_CASE("ByteBuffer round trip", "[distributed][utility]") {
+  std::string buffer;
+  dirdevo::ByteWriter out(buffer);
+  out.Write<uint64_t>(42);
+  out.Write<double>(-1.5);
+  out.WriteString("hello");
+  out.Write<uint8_t>(7);
+
+  dirdevo::ByteReader in(buffer);
+  REQUIRE(in.Read<uint64_t>() == 42);
+  REQUIRE(in.Read<double>() == -1.5);
+  REQUIRE(in.ReadString() == "hello");
+  REQUIRE(in.Read<uint8_t>() == 7);
+  REQUIRE(in.AtEnd());
+}
+
+TEST_CASE("LocalTransport", "[distributed]") {
+  dirdevo::LocalTransport transport;
+  emp::vector<std::string> recv;
+  transport.AllGather("abc", recv);
+  REQUIRE(transport.GetNumRanks() == 1);
+  REQUIRE(recv.size() == 1);
+  REQUIRE(recv[0] == "abc");
+}
+
+TEST_CASE("UnixSocketTransport", "[distributed]") {
+  constexpr size_t num_ranks = 4;
+  const std::string path = "/tmp/dirdevo-test-" + std::to_string(getpid()) + ".sock";
+
+  // Run each rank on its own thread (each rank gets its own socket connection, just like separate processes).
+  emp::vector<emp::vector<std::string>> results(num_ranks);
+  emp::vector<std::thread> threads;
+  for (size_t rank = 0; rank < num_ranks; ++rank) {
+    threads.emplace_back(
+      [&results, &path, rank]() {
+        dirdevo::UnixSocketTransport transport(path, rank, num_ranks, 10);
+        // Payload size depends on rank (including an empty payload) to exercise framing.
+        transport.AllGather(std::string(rank * 100000, (char)('a' + rank)), results[rank]);
+        transport.Barrier();
+      }
+    );
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (size_t rank = 0; rank < num_ranks; ++rank) {
+    REQUIRE(results[rank].size() == num_ranks);
+    for (size_t src = 0; src < num_ranks; ++src) {
+      REQUIRE(results[rank][src] == std::string(src * 100000, (char)('a' + src)));
+    }
+  }
+}
@@ -0,0 +1,78 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "emp/base/vector.hpp"
+#include "emp/bits/BitSet.hpp"
+#include "emp/math/Random.hpp"
+
+#include "dirdevo/DirectedDevoWorld.hpp"
+#include "dirdevo/DirectedDevoConfig.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxOrganism.hpp"
+#include "dirdevo/ExperimentSetups/OneMax/OneMaxTask.hpp"
+#include "dirdevo/mutator/BitSetMutator.hpp"
+
+using org_t = dirdevo::OneMaxOrganism<64>;
+using task_t = dirdevo::OneMaxTask<org_t>;
+using world_t = dirdevo::DirectedDevoWorld<org_t, task_t>;
+
+/// Genomes in each (occupied) cell of the world.
+emp::vector<org_t::genome_t> get_genomes(world_t& world) {
+  emp::vector<org_t::genome_t> genomes;
+  for (size_t pos = 0; pos < world.GetSize(); ++pos) {
+    if (world.IsOccupied({pos})) genomes.emplace_back(world.GetOrg(pos).GetGenome());
+  }
+  return genomes;
+}
+
+TEST_CASE("Skipping updates matches stepping an extinct world", "[world]") {
+  dirdevo::DirectedDevoConfig config;
+  emp::Random stepped_random(2);
+  emp::Random skipped_random(2);
+  world_t stepped(config, stepped_random, "stepped");
+  world_t skipped(config, skipped_random, "skipped");
+
+  for (size_t num_updates : emp::vector<size_t>({3, 0, 1, 7, 25})) {
+    for (size_t u = 0; u < num_updates; ++u) {
+      stepped.RunStep();
+      stepped.Update();
+    }
+    skipped.SkipUpdates(num_updates);
+    REQUIRE(skipped.GetUpdate() == stepped.GetUpdate());
+    REQUIRE(skipped.IsExtinct() == stepped.IsExtinct());
+    REQUIRE(skipped.IsExtinct());
+    REQUIRE(skipped.GetNumOrgs() == 0);
+  }
+  REQUIRE(skipped.GetUpdate() == 36);
+}
+
+TEST_CASE("Skipping updates freezes a living world", "[world]") {
+  dirdevo::DirectedDevoConfig config;
+  emp::Random random(2);
+  world_t world(config, random, "world");
+  world.SetAvgOrgStepsPerUpdate(config.AVG_STEPS_PER_ORG());
+  dirdevo::BitSetMutator mutator;
+  dirdevo::BitSetMutator::Configure(mutator, config);
+  world.SetMutator(mutator);
+  world.InjectAt(org_t::GenerateAncestralGenome(world), 0);
+  world.SyncSchedulerWeights();
+  for (size_t u = 0; u < 50; ++u) {
+    world.RunStep();
+    world.Update();
+  }
+  REQUIRE(world.GetNumOrgs() > 0);
+
+  const size_t update = world.GetUpdate();
+  const auto genomes = get_genomes(world);
+  world.SkipUpdates(0);
+  REQUIRE(world.GetUpdate() == update);
+  world.SkipUpdates(20);
+  REQUIRE(world.GetUpdate() == update + 20);
+  REQUIRE(!world.IsExtinct());
+  REQUIRE(get_genomes(world) == genomes);
+
+  // The world picks up where it left off.
+  world.RunStep();
+  world.Update();
+  REQUIRE(world.GetUpdate() == update + 21);
+}